@@ -156,6 +156,9 @@ struct coredump_cmd_copy_arg {
 #define	COREDUMP_MEM_HDR_ID		'M'
 #define COREDUMP_MEM_HDR_VER		1
 
+#define	COREDUMP_FILL_MEM_HDR_ID	'F'
+#define COREDUMP_FILL_MEM_HDR_VER	1
+
 /* Target code */
 enum coredump_tgt_code {
 	COREDUMP_TGT_UNKNOWN = 0,
@@ -226,6 +229,24 @@ struct coredump_mem_hdr_t {
 	uintptr_t	end;
 } __packed;
 
+/* Memory block filled with a single byte value, no data follows */
+struct coredump_fill_mem_hdr_t {
+	/* COREDUMP_FILL_MEM_HDR_ID */
+	char		id;
+
+	/* Header version */
+	uint16_t	hdr_version;
+
+	/* Address of start of memory region */
+	uintptr_t	start;
+
+	/* Address of end of memory region */
+	uintptr_t	end;
+
+	/* Value of every byte within the memory region */
+	uint8_t		fill;
+} __packed;
+
 typedef void (*coredump_backend_start_t)(void);
 typedef void (*coredump_backend_end_t)(void);
 typedef void (*coredump_backend_buffer_output_t)(uint8_t *buf, size_t buflen);
@@ -17,6 +17,10 @@
 
 #include <zephyr/storage/stream_flash.h>
 
+#ifdef CONFIG_IMG_STREAM_HASH
+#include <psa/crypto.h>
+#endif
+
 /**
  * @brief Abstraction layer to write firmware images to flash
  *
@@ -33,6 +37,16 @@ struct flash_img_context {
 	uint8_t buf[CONFIG_IMG_BLOCK_BUF_SIZE];
 	const struct flash_area *flash_area;
 	struct stream_flash_ctx stream;
+#if defined(CONFIG_IMG_STREAM_HASH) || defined(__DOXYGEN__)
+	/** Running SHA-256 of the data written */
+	psa_hash_operation_t hash_op;
+	/** SHA-256 of the data written, once the write has been flushed */
+	uint8_t hash[PSA_HASH_LENGTH(PSA_ALG_SHA_256)];
+	/** Number of bytes hashed */
+	size_t hash_len;
+	/** State of the hash computation */
+	uint8_t hash_state;
+#endif
 };
 
 /**
@@ -111,6 +125,27 @@ int flash_img_check(struct flash_img_context *ctx,
 		    const struct flash_img_check *fic,
 		    uint8_t area_id);
 
+/**
+ * @brief  Verify the image written with a context against an expected hash,
+ * using the SHA-256 computed while the image was written instead of reading it
+ * back from flash.
+ *
+ * The function is enabled via CONFIG_IMG_STREAM_HASH Kconfig option. The image
+ * must have been written with @p ctx since flash_img_init() or
+ * flash_img_init_id(), ending with a flush. Unlike flash_img_check(), this
+ * verifies the data given to flash_img_buffered_write() rather than the data
+ * read back from flash.
+ *
+ * @param[in] ctx context used to write the image.
+ * @param[in] fic flash img check data.
+ *
+ * @return  0 on success, -EILSEQ if the hash does not match, -ENODATA if
+ * @p ctx has not hashed exactly fic->clen bytes of a flushed image, other
+ * negative errno code on fail
+ */
+int flash_img_check_hash(struct flash_img_context *ctx,
+			 const struct flash_img_check *fic);
+
 /**
  * @brief Get the flash area id for the image upload slot.
  *
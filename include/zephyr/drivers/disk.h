@@ -108,6 +108,10 @@ struct disk_info {
 	const struct device *dev;
 	/** Internally used disk reference count */
 	uint16_t refcnt;
+#if defined(CONFIG_DISK_ACCESS_CACHE) || defined(__DOXYGEN__)
+	/** Internally used by the block cache to remember if the disk is cached */
+	uint8_t cache_state;
+#endif
 };
 
 /**
@@ -84,6 +84,26 @@ struct fcb_entry_ctx {
  */
 #define FCB_FLAGS_CRC_DISABLED BIT(0)
 
+#ifdef CONFIG_FCB_INDEX
+/**
+ * @brief RAM index of the entries in one FCB sector.
+ *
+ * Holds the offsets of the first CONFIG_FCB_INDEX_SECTOR_ENTRIES valid entries
+ * of the sector, entries beyond that are only counted and reached by walking
+ * from the last indexed one.
+ */
+struct fcb_sector_index {
+	uint16_t fi_id;
+	/**< Id of the sector, internal state */
+
+	uint32_t fi_count;
+	/**< Number of valid entries in the sector, internal state */
+
+	uint32_t fi_off[CONFIG_FCB_INDEX_SECTOR_ENTRIES];
+	/**< Offsets of the entries from the start of the sector, internal state */
+};
+#endif
+
 /**
  * @brief FCB instance structure
  *
@@ -141,6 +161,15 @@ struct fcb {
 	const uint8_t f_flags;
 	/**< Flags for configuring the FCB. */
 #endif
+#ifdef CONFIG_FCB_INDEX
+	struct fcb_sector_index *f_index;
+	/**< Optional array of f_sector_cnt sector indexes, filled in by the
+	 * caller of fcb_init. When set, fcb_init builds an index of the entry
+	 * locations, which is kept up to date by FCB and lets
+	 * @ref fcb_offset_last_n and @ref fcb_seek find entries without
+	 * walking the buffer from the oldest sector.
+	 */
+#endif
 };
 
 /**
@@ -286,6 +315,9 @@ int fcb_is_empty(struct fcb *fcbp);
 /**
  * Finds the fcb entry that gives back up to n entries at the end.
  *
+ * When the fcb has a RAM index (see @ref fcb::f_index) the entry is found
+ * from the entry counts of the newest sectors, without walking the buffer.
+ *
  * @param[in] fcbp          FCB instance structure.
  * @param[in] entries       number of fcb entries the user wants to get
  * @param[out] last_n_entry last_n_entry the fcb_entry to be returned
@@ -294,6 +326,44 @@ int fcb_is_empty(struct fcb *fcbp);
  */
 int fcb_offset_last_n(struct fcb *fcbp, uint8_t entries, struct fcb_entry *last_n_entry);
 
+/**
+ * Get the sequence number of an fcb entry.
+ *
+ * The sequence number identifies the entry for as long as it is stored, it is
+ * made of the id of the sector holding the entry in the upper 16 bits and the
+ * position of the entry within that sector in the lower 16 bits. Sequence
+ * numbers of newer entries compare greater, except when sector ids wrap around.
+ * Requires CONFIG_FCB_INDEX and an fcb with f_index set.
+ *
+ * @param[in] fcbp FCB instance structure.
+ * @param[in] loc  entry location information, as returned by @ref fcb_getnext
+ *                 or @ref fcb_seek.
+ * @param[out] seq sequence number of the entry.
+ *
+ * @return 0 on success; -ENOTSUP if the fcb has no index; -ENOENT if the entry
+ *         is not stored in the fcb; -ERANGE if its position in the sector does
+ *         not fit 16 bits.
+ */
+int fcb_entry_seq(struct fcb *fcbp, const struct fcb_entry *loc, uint32_t *seq);
+
+/**
+ * Find the fcb entry with the given sequence number.
+ *
+ * Uses the RAM index to locate the entry, reading at most the entries of one
+ * sector that exceed CONFIG_FCB_INDEX_SECTOR_ENTRIES. @ref fcb_getnext can be
+ * used on the returned location to continue with the entries after it.
+ * Requires CONFIG_FCB_INDEX and an fcb with f_index set.
+ *
+ * @param[in] fcbp FCB instance structure.
+ * @param[in] seq  sequence number, as returned by @ref fcb_entry_seq.
+ * @param[out] loc entry location information.
+ *
+ * @return 0 on success; -ENOTSUP if the fcb has no index; -ENOENT if there is
+ *         no entry with that sequence number (anymore); other negative errno
+ *         code on flash read failure.
+ */
+int fcb_seek(struct fcb *fcbp, uint32_t seq, struct fcb_entry *loc);
+
 /**
  * Clear fcb instance storage.
  *
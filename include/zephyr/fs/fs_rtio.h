@@ -0,0 +1,123 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_FS_FS_RTIO_H_
+#define ZEPHYR_INCLUDE_FS_FS_RTIO_H_
+
+#include <sys/types.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/rtio/rtio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Asynchronous File System APIs
+ * @defgroup file_system_rtio_api Asynchronous File System APIs
+ * @ingroup file_system_api
+ * @{
+ */
+
+/**
+ * @brief Offset value selecting the current file position
+ *
+ * Requests on a file I/O device with this offset start at, and advance,
+ * the position of the underlying file, as @ref fs_read and @ref fs_write do.
+ */
+#define FS_RTIO_OFFSET_CURRENT ((off_t)-1)
+
+/**
+ * @brief Submission flag requesting @ref fs_sync of the file
+ *
+ * Set in @c iodev_flags of a submission. For reads and writes the file is
+ * synchronized once the transfer succeeded. See @ref fs_rtio_sqe_prep_sync.
+ */
+#define FS_RTIO_SYNC BIT(0)
+
+/**
+ * @brief File I/O device data
+ *
+ * Read (RTIO_OP_RX) and write (RTIO_OP_TX) submissions to a file I/O device
+ * are executed by the file system RTIO worker serving the mount point of
+ * @c file. Submissions to files on the same mount point complete in the
+ * order they were submitted. The completion result is the number of bytes
+ * transferred, or a negative errno code. A read using the memory pool of the
+ * RTIO context reads at most one block of the pool.
+ */
+struct fs_rtio_file {
+	/** Opened file the requests operate on */
+	struct fs_file_t *file;
+	/**
+	 * Offset of the next request, or @ref FS_RTIO_OFFSET_CURRENT.
+	 * Advanced by the number of bytes transferred by each request.
+	 */
+	off_t offset;
+	/**
+	 * Optional mutex held while a request executes, to serialize
+	 * requests with other users of @c file. May be NULL.
+	 */
+	struct k_mutex *lock;
+};
+
+/** @brief I/O device API executing requests on a @ref fs_rtio_file */
+extern const struct rtio_iodev_api fs_rtio_iodev_api;
+
+/**
+ * @brief Statically define a file I/O device
+ *
+ * @param name Name of the I/O device
+ * @param zfp Pointer to the @c struct fs_file_t the device operates on
+ */
+#define FS_RTIO_IODEV_DEFINE(name, zfp)							\
+	static struct fs_rtio_file _fs_rtio_file_##name = {				\
+		.file = (zfp),								\
+		.offset = FS_RTIO_OFFSET_CURRENT,					\
+	};										\
+	RTIO_IODEV_DEFINE(name, &fs_rtio_iodev_api, &_fs_rtio_file_##name)
+
+/**
+ * @brief Initialize a file I/O device at runtime
+ *
+ * @param iodev I/O device to initialize
+ * @param data File I/O device data, must outlive the I/O device
+ * @param zfp Opened file the device operates on
+ * @param offset Offset of the first request, or @ref FS_RTIO_OFFSET_CURRENT
+ */
+static inline void fs_rtio_iodev_init(struct rtio_iodev *iodev, struct fs_rtio_file *data,
+				      struct fs_file_t *zfp, off_t offset)
+{
+	data->file = zfp;
+	data->offset = offset;
+	data->lock = NULL;
+	iodev->api = &fs_rtio_iodev_api;
+	iodev->data = data;
+}
+
+/**
+ * @brief Prepare a file synchronization submission
+ *
+ * The submission completes with 0 once @ref fs_sync returned, or with its
+ * negative errno code.
+ */
+static inline void fs_rtio_sqe_prep_sync(struct rtio_sqe *sqe, const struct rtio_iodev *iodev,
+					 void *userdata)
+{
+	rtio_sqe_prep_nop(sqe, iodev, userdata);
+	sqe->iodev_flags = FS_RTIO_SYNC;
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_FS_FS_RTIO_H_ */
@@ -49,6 +49,12 @@ struct fs_littlefs {
 	 */
 	uint32_t *lookahead_buffer[CONFIG_FS_LITTLEFS_LOOKAHEAD_SIZE / sizeof(uint32_t)];
 
+	/* Optional pool of per-file caches, blocks must be at least
+	 * cfg.cache_size.  When NULL, file caches are allocated from
+	 * the heap shared by all littlefs mounts.
+	 */
+	struct k_mem_slab *file_cache;
+
 	/* These structures are filled automatically at mount. */
 	struct lfs lfs;
 	void *backend;
@@ -73,7 +79,8 @@ struct fs_littlefs {
  *
  * @note If you use a non-default configuration for cache size, you
  * must also select @kconfig{CONFIG_FS_LITTLEFS_FC_HEAP_SIZE} to relax
- * the size constraints on per-file cache allocations.
+ * the size constraints on per-file cache allocations, or use
+ * @ref FS_LITTLEFS_DECLARE_CUSTOM_CONFIG_FILE_CACHE instead.
  *
  * @param name the name for the structure.  The defined object has
  * file scope.
@@ -100,6 +107,46 @@ struct fs_littlefs {
 		},									  \
 	}
 
+/** @brief Define a littlefs configuration with customized size
+ * characteristics and its own pool of per-file caches.
+ *
+ * This is @ref FS_LITTLEFS_DECLARE_CUSTOM_CONFIG with an additional
+ * memory slab holding @p num_files caches of @p cache_sz bytes.  Files
+ * opened on the mount take their cache from this pool, so the mount
+ * can use a cache size other than @kconfig{CONFIG_FS_LITTLEFS_CACHE_SIZE}
+ * without growing @kconfig{CONFIG_FS_LITTLEFS_FC_HEAP_SIZE}, and its
+ * open files cannot exhaust the caches of other mounts.
+ *
+ * @param name the name for the structure.  The defined object has
+ * file scope.
+ * @param alignment needed alignment for read/prog buffer for specific device
+ * @param read_sz see @kconfig{CONFIG_FS_LITTLEFS_READ_SIZE}
+ * @param prog_sz see @kconfig{CONFIG_FS_LITTLEFS_PROG_SIZE}
+ * @param cache_sz see @kconfig{CONFIG_FS_LITTLEFS_CACHE_SIZE}
+ * @param lookahead_sz see @kconfig{CONFIG_FS_LITTLEFS_LOOKAHEAD_SIZE}
+ * @param num_files maximum number of files open at the same time on the
+ * mount
+ */
+#define FS_LITTLEFS_DECLARE_CUSTOM_CONFIG_FILE_CACHE(name, alignment, read_sz, prog_sz,	  \
+						     cache_sz, lookahead_sz, num_files)	  \
+	static uint8_t __aligned(alignment) name ## _read_buffer[cache_sz];		  \
+	static uint8_t __aligned(alignment) name ## _prog_buffer[cache_sz];		  \
+	static uint32_t name ## _lookahead_buffer[(lookahead_sz) / sizeof(uint32_t)];	  \
+	K_MEM_SLAB_DEFINE_STATIC(name ## _file_cache, ROUND_UP(cache_sz, alignment),	  \
+				 num_files, alignment);					  \
+	static struct fs_littlefs name = {						  \
+		.cfg = {								  \
+			.read_size = (read_sz),						  \
+			.prog_size = (prog_sz),						  \
+			.cache_size = (cache_sz),					  \
+			.lookahead_size = (lookahead_sz),				  \
+			.read_buffer = name ## _read_buffer,				  \
+			.prog_buffer = name ## _prog_buffer,				  \
+			.lookahead_buffer = name ## _lookahead_buffer,			  \
+		},									  \
+		.file_cache = &name ## _file_cache,					  \
+	}
+
 /** @brief Define a littlefs configuration with default characteristics.
  *
  * This defines static arrays and initializes the littlefs
@@ -53,6 +53,8 @@ struct nvs_fs {
 	uint16_t sector_count;
 	/** Flag indicating if the file system is initialized */
 	bool ready;
+	/** Number of garbage collections and clears, see nvs_gc_count_get() */
+	uint32_t gc_count;
 	/** Mutex */
 	struct k_mutex nvs_lock;
 	/** Flash device runtime structure */
@@ -62,8 +64,42 @@ struct nvs_fs {
 #if CONFIG_NVS_LOOKUP_CACHE
 	uint32_t lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
 #endif
+#if defined(CONFIG_NVS_BACKGROUND_GC) || defined(__DOXYGEN__)
+	/** Free bytes in the active sector below which garbage collection is started in the
+	 * background, 0 disables background garbage collection. Set before nvs_mount().
+	 */
+	uint32_t gc_threshold;
+	/** Free bytes in the active sector right after it was opened */
+	uint32_t gc_free_start;
+	/** Garbage collection requested by nvs_write_nowait() */
+	bool gc_forced;
+	/** Background garbage collection work item */
+	struct k_work gc_work;
+#endif
+};
+
+/**
+ * @brief Entry reported by nvs_walk()
+ */
+struct nvs_walk_entry {
+	/** Id of the entry */
+	uint16_t id;
+	/** Length of the entry data, 0 for a deleted entry */
+	size_t len;
+	/** Address of the allocation table entry, used by nvs_walk_read() */
+	uint32_t ate_addr;
 };
 
+/**
+ * @brief Callback invoked by nvs_walk() for each entry
+ *
+ * @param entry Entry found in the file system
+ * @param arg Argument given to nvs_walk()
+ *
+ * @return 0 to continue the walk, any other value stops it.
+ */
+typedef int (*nvs_walk_cb_t)(const struct nvs_walk_entry *entry, void *arg);
+
 /**
  * @}
  */
@@ -112,6 +148,26 @@ int nvs_clear(struct nvs_fs *fs);
  */
 ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len);
 
+/**
+ * @brief Write an entry to the file system without waiting for garbage collection.
+ *
+ * Same as nvs_write(), but the call never erases flash. When the entry does not fit into the
+ * active sector, garbage collection is queued on the system work queue and the call fails, so
+ * the write latency is bounded by a single entry write.
+ *
+ * @note Requires @kconfig{CONFIG_NVS_BACKGROUND_GC}.
+ *
+ * @param fs Pointer to file system
+ * @param id Id of the entry to be written
+ * @param data Pointer to the data to be written
+ * @param len Number of bytes to be written
+ *
+ * @return Number of bytes written, or 0 when the same data is already stored.
+ * @retval -EAGAIN The file system is busy or garbage collection is required, retry later.
+ * @retval -ERRNO Other errno code on error.
+ */
+ssize_t nvs_write_nowait(struct nvs_fs *fs, uint16_t id, const void *data, size_t len);
+
 /**
  * @brief Delete an entry from the file system
  *
@@ -153,6 +209,41 @@ ssize_t nvs_read(struct nvs_fs *fs, uint16_t id, void *data, size_t len);
  */
 ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len, uint16_t cnt);
 
+/**
+ * @brief Walk through all entries stored in the file system.
+ *
+ * The allocation table is read once, sequentially, from the newest to the oldest entry. All
+ * entries are reported, including older versions and deletions of an id, so the first entry
+ * reported for an id is its most recent one. This is much faster than reading a large set of
+ * ids one by one.
+ *
+ * @note The file system must not be written from @p cb.
+ *
+ * @param fs Pointer to file system
+ * @param cb Callback invoked for each entry
+ * @param arg Argument passed to @p cb
+ *
+ * @return 0 when all entries have been walked, the non-zero value returned by @p cb if it
+ * stopped the walk. On error, returns negative value of errno.h defined error codes.
+ */
+int nvs_walk(struct nvs_fs *fs, nvs_walk_cb_t cb, void *arg);
+
+/**
+ * @brief Read the data of an entry reported by nvs_walk().
+ *
+ * @param fs Pointer to file system
+ * @param entry Entry reported by nvs_walk()
+ * @param data Pointer to data buffer
+ * @param len Number of bytes to be read
+ *
+ * @return Number of bytes read, as for nvs_read(). -ENOENT is returned when the entry has
+ * been deleted or moved by garbage collection after it was reported, in which case it can
+ * still be read with nvs_read(). On error, returns negative value of errno.h defined error
+ * codes.
+ */
+ssize_t nvs_walk_read(struct nvs_fs *fs, const struct nvs_walk_entry *entry, void *data,
+		      size_t len);
+
 /**
  * @brief Calculate the available free space in the file system.
  *
@@ -188,6 +279,18 @@ size_t nvs_sector_max_data_size(struct nvs_fs *fs);
  */
 int nvs_sector_use_next(struct nvs_fs *fs);
 
+/**
+ * @brief Get the number of times entries may have been moved or erased.
+ *
+ * The count is incremented by each garbage collection and by nvs_clear(). Entries reported
+ * by nvs_walk() stay at the same place as long as the count does not change.
+ *
+ * @param fs Pointer to the file system.
+ *
+ * @return Number of garbage collections and clears.
+ */
+uint32_t nvs_gc_count_get(struct nvs_fs *fs);
+
 /**
  * @}
  */
@@ -141,6 +141,55 @@ int zms_clear(struct zms_fs *fs);
  */
 ssize_t zms_write(struct zms_fs *fs, zms_id_t id, const void *data, size_t len);
 
+/**
+ * @brief Entry of a batch written with @ref zms_write_batch().
+ */
+struct zms_batch_entry {
+	/** ID of the entry to be written */
+	zms_id_t id;
+	/** Pointer to the data to be written */
+	const void *data;
+	/** Number of bytes to be written, 0 deletes the entry */
+	size_t len;
+};
+
+/**
+ * @brief Write several entries to the file system as one atomic operation.
+ *
+ * The entries are written one after the other into the active sector, between two markers.
+ * If the write is interrupted, for example by a power loss, none of the entries is visible
+ * after the next mount and the previous values are kept.
+ * Compared to calls to @ref zms_write(), the file system is locked and its free space checked
+ * only once. Entries are always written, even with @kconfig{CONFIG_ZMS_NO_DOUBLE_WRITE}.
+ *
+ * @param fs Pointer to the file system.
+ * @param entries Array of entries to be written, in order.
+ * @param count Number of entries in `entries`.
+ *
+ * @return Sum of the lengths of the entries on success.
+ * @retval -EACCES if ZMS is still not initialized.
+ * @retval -ENXIO if there is a device error.
+ * @retval -EIO if there is a memory read/write error.
+ * @retval -EINVAL if `fs` is NULL, an entry is invalid or the batch does not fit into a sector.
+ * @retval -ENOSPC if no space is left on the device.
+ */
+ssize_t zms_write_batch(struct zms_fs *fs, const struct zms_batch_entry *entries, size_t count);
+
+/**
+ * @brief Check if entries can be written with @ref zms_write_batch().
+ *
+ * A batch has to fit into a single sector. Larger sets of entries can only be written with
+ * separate calls to @ref zms_write().
+ *
+ * @param fs Pointer to the file system.
+ * @param entries Array of entries to be written.
+ * @param count Number of entries in `entries`.
+ *
+ * @retval true if the entries are valid and fit into a sector.
+ * @retval false otherwise, or if ZMS is not initialized.
+ */
+bool zms_batch_fits(struct zms_fs *fs, const struct zms_batch_entry *entries, size_t count);
+
 /**
  * @brief Delete an entry from the file system
  *
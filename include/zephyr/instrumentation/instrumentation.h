@@ -221,6 +221,27 @@ void *instr_get_trigger_func(void);
  */
 void *instr_get_stop_func(void);
 
+/**
+ * @brief Restrict event generation to functions in an address range.
+ *
+ * Only functions whose address is in [start, end) generate tracing and
+ * profiling events, which allows instrumenting a single module while keeping
+ * the rest of the system running at close to full speed. Context switches are
+ * always traced.
+ *
+ * @param start Start address of the range
+ * @param end End address of the range (exclusive), NULL to remove the filter
+ */
+void instr_set_filter(void *start, void *end);
+
+/**
+ * @brief Get the address range set by instr_set_filter().
+ *
+ * @param start Pointer to store the start address of the range
+ * @param end Pointer to store the end address of the range, NULL if not set
+ */
+void instr_get_filter(void **start, void **end);
+
 #ifdef __cplusplus
 }
 #endif
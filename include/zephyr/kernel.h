@@ -3418,6 +3418,10 @@ struct k_mutex {
 #ifdef CONFIG_OBJ_CORE_MUTEX
 	struct k_obj_core obj_core;
 #endif
+
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	struct k_lock_stats stats;
+#endif
 };
 
 /**
@@ -3620,6 +3624,9 @@ struct k_sem {
 
 #ifdef CONFIG_OBJ_CORE_SEM
 	struct k_obj_core  obj_core;
+#endif
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	struct k_lock_stats stats;
 #endif
 	/** @endcond */
 };
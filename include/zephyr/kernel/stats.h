@@ -27,7 +27,33 @@ struct k_cycle_stats {
 	uint32_t  num_windows;  /**< \# of usage windows */
 	/** @} */
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#if defined(CONFIG_SCHED_THREAD_USAGE_LATENCY) || defined(__DOXYGEN__)
+	/**
+	 * @name Fields available when CONFIG_SCHED_THREAD_USAGE_LATENCY is selected.
+	 * @{
+	 */
+	uint32_t  ready;        /**< timestamp of becoming ready, 0 if none */
+	/** Scheduling latency histogram, bucket n counts latencies in
+	 * [2^(n-1), 2^n) cycles, the last bucket also counts longer ones.
+	 */
+	uint32_t  latency[CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS];
+	/** @} */
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
 	bool      track_usage;  /**< true if gathering usage stats */
 };
 
+struct k_thread;
+
+/**
+ * Structure used to track contention statistics of kernel
+ * synchronization objects (mutexes and semaphores).
+ */
+struct k_lock_stats {
+	uint32_t  acquired;     /**< \# of successful acquisitions */
+	uint32_t  contended;    /**< \# of acquisitions that had to wait */
+	uint64_t  wait_cycles;  /**< total # of cycles spent waiting */
+	uint32_t  max_wait_cycles; /**< longest wait in cycles */
+	struct k_thread *holder; /**< last thread to acquire the object */
+};
+
 #endif /* ZEPHYR_INCLUDE_KERNEL_STATS_H_ */
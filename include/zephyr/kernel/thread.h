@@ -227,6 +227,16 @@ typedef struct k_thread_runtime_stats {
 	uint64_t average_cycles;      /* average # of non-idle cycles */
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	/*
+	 * Histogram of the cycles spent between becoming ready and being
+	 * switched in. Bucket n counts latencies in [2^(n-1), 2^n) cycles,
+	 * the last bucket also counts all longer latencies. For CPUs it
+	 * covers all threads switched in on that CPU.
+	 */
+	uint32_t latency[CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS];
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 	/*
 	 * This field is always zero for individual threads. It only comes
@@ -151,6 +151,9 @@ int img_mgmt_client_upload_init(struct img_mgmt_client *client, size_t image_siz
  * @param res_buf	Pointer for command response structure.
  *
  * @return 0 on success.
+ * @return MGMT_ERR_EBUSY when the server stopped accepting chunks sent with
+ *	   CONFIG_MCUMGR_GRP_IMG_CLIENT_UPLOAD_WINDOW larger than 1; the upload can be
+ *	   continued from the offset in @p res_buf.
  * @return @ref mcumgr_err_t code on failure.
  */
 int img_mgmt_client_upload(struct img_mgmt_client *client, const uint8_t *data, size_t length,
@@ -387,6 +387,50 @@ struct coap_pending {
 	struct coap_transmission_parameters params; /**< Transmission parameters */
 };
 
+/**
+ * @brief Retransmission queue of pending requests.
+ *
+ * Tracks the active entries of an array of #coap_pending structures by
+ * message ID, so that a response is matched without scanning the array,
+ * and by expiry time, so that a retransmission pass only visits the
+ * expired entries. The array can hold up to UINT8_MAX entries.
+ */
+struct coap_pending_queue {
+	struct coap_pending *pendings; /**< Array of pending requests */
+	uint8_t *by_id;                /**< Queued entries sorted by message ID */
+	uint8_t *by_expiry;            /**< Queued entries sorted by expiry time */
+	uint8_t size;                  /**< Size of the arrays */
+	uint8_t count;                 /**< Number of queued entries */
+};
+
+/**
+ * @brief Static initializer for a #coap_pending_queue.
+ *
+ * @param _pendings Array of #coap_pending structures
+ * @param _by_id Array of uint8_t of the same size as @p _pendings
+ * @param _by_expiry Array of uint8_t of the same size as @p _pendings
+ */
+#define COAP_PENDING_QUEUE_INITIALIZER(_pendings, _by_id, _by_expiry)	\
+	{								\
+		.pendings = (_pendings),				\
+		.by_id = (_by_id),					\
+		.by_expiry = (_by_expiry),				\
+		.size = ARRAY_SIZE(_pendings),				\
+	}
+
+/**
+ * @typedef coap_pending_expired_t
+ * @brief Type of the callback being called for each expired entry of a
+ * #coap_pending_queue.
+ *
+ * @param pending The expired pending request
+ * @param retransmit true if the request has to be sent again, false if no
+ * retransmission is left and the entry was removed from the queue
+ * @param user_data User data passed to coap_pending_queue_expire()
+ */
+typedef void (*coap_pending_expired_t)(struct coap_pending *pending,
+				       bool retransmit, void *user_data);
+
 /**
  * @brief Represents the handler for the reply of a request, it is
  * also used when observing resources.
@@ -1228,6 +1272,88 @@ void coap_pendings_clear(struct coap_pending *pendings, size_t len);
  */
 size_t coap_pendings_count(struct coap_pending *pendings, size_t len);
 
+/**
+ * @brief Initialize a retransmission queue.
+ *
+ * @param queue Queue to initialize
+ * @param pendings Array of #coap_pending structures
+ * @param by_id Array of @p len entries used to sort the queue by message ID
+ * @param by_expiry Array of @p len entries used to sort the queue by expiry time
+ * @param len Size of the arrays, at most UINT8_MAX
+ */
+void coap_pending_queue_init(struct coap_pending_queue *queue,
+			     struct coap_pending *pendings,
+			     uint8_t *by_id, uint8_t *by_expiry, size_t len);
+
+/**
+ * @brief Add a pending request to a retransmission queue.
+ *
+ * The pending request must belong to the array of the queue, must not be
+ * queued yet and must have been cycled with coap_pending_cycle() so that
+ * its timeout is set.
+ *
+ * @param queue Retransmission queue
+ * @param pending Pending request to add
+ *
+ * @return 0 in case of success or negative in case of error.
+ */
+int coap_pending_queue_add(struct coap_pending_queue *queue,
+			   struct coap_pending *pending);
+
+/**
+ * @brief Remove a pending request from a retransmission queue.
+ *
+ * The pending request itself is left untouched, use coap_pending_clear()
+ * to make it available again.
+ *
+ * @param queue Retransmission queue
+ * @param pending Pending request to remove
+ */
+void coap_pending_queue_remove(struct coap_pending_queue *queue,
+			       struct coap_pending *pending);
+
+/**
+ * @brief Check if a CoAP packet is a response to a queued pending request,
+ * using a binary search on the message ID.
+ *
+ * @param queue Retransmission queue
+ * @param response The received packet
+ *
+ * @return pointer to the associated #coap_pending structure, NULL in
+ * case none was found.
+ */
+struct coap_pending *coap_pending_queue_received(
+	const struct coap_pending_queue *queue,
+	const struct coap_packet *response);
+
+/**
+ * @brief Returns the next queued pending request about to expire.
+ *
+ * @param queue Retransmission queue
+ *
+ * @return The next #coap_pending to expire, NULL if the queue is empty.
+ */
+struct coap_pending *coap_pending_queue_next_to_expire(
+	const struct coap_pending_queue *queue);
+
+/**
+ * @brief Handle all the queued pending requests expired at @p now in a
+ * single pass.
+ *
+ * Each expired request is cycled with coap_pending_cycle() and requeued by
+ * its new expiry time, or removed from the queue when no retransmission is
+ * left. @p cb is called for each of them and must not modify the queue.
+ *
+ * @param queue Retransmission queue
+ * @param now Current uptime in milliseconds
+ * @param cb Callback called for each expired request
+ * @param user_data User data passed to @p cb
+ *
+ * @return Number of expired requests handled.
+ */
+size_t coap_pending_queue_expire(struct coap_pending_queue *queue, int64_t now,
+				 coap_pending_expired_t cb, void *user_data);
+
 /**
  * @brief Cancels awaiting for this reply, so it becomes available
  * again. User responsibility to free the memory associated with data.
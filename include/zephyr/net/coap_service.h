@@ -47,6 +47,9 @@ struct coap_service_data {
 	int sock_fd;
 	struct coap_observer observers[CONFIG_COAP_SERVICE_OBSERVERS];
 	struct coap_pending pending[CONFIG_COAP_SERVICE_PENDING_MESSAGES];
+	uint8_t pending_by_id[CONFIG_COAP_SERVICE_PENDING_MESSAGES];
+	uint8_t pending_by_expiry[CONFIG_COAP_SERVICE_PENDING_MESSAGES];
+	struct coap_pending_queue pending_queue;
 };
 
 struct coap_service {
@@ -75,6 +78,10 @@ struct coap_service {
 				_sec_tag_list, _sec_tag_list_size)				\
 	static struct coap_service_data _CONCAT(coap_service_data_, _name) = {			\
 		.sock_fd = -1,									\
+		.pending_queue = COAP_PENDING_QUEUE_INITIALIZER(				\
+			_CONCAT(coap_service_data_, _name).pending,				\
+			_CONCAT(coap_service_data_, _name).pending_by_id,			\
+			_CONCAT(coap_service_data_, _name).pending_by_expiry),			\
 	};											\
 	const STRUCT_SECTION_ITERABLE(coap_service, _name) = {					\
 		.name = STRINGIFY(_name),							\
@@ -883,6 +883,14 @@ struct mqtt_internal {
 	/** Internal. Remaining payload length to read. */
 	uint32_t remaining_payload;
 
+#if defined(CONFIG_MQTT_INFLIGHT_WINDOW) || defined(__DOXYGEN__)
+	/** Internal. Number of QoS 1 and QoS 2 publish messages not acknowledged yet. */
+	uint16_t inflight_publish;
+
+	/** Internal. Maximum number of publish messages allowed in flight. */
+	uint16_t inflight_publish_max;
+#endif /* CONFIG_MQTT_INFLIGHT_WINDOW */
+
 #if defined(CONFIG_MQTT_VERSION_5_0) || defined(__DOXYGEN__)
 	/** Internal. MQTT 5.0 topic alias mapping. */
 	struct mqtt_topic_alias topic_aliases[CONFIG_MQTT_TOPIC_ALIAS_MAX];
@@ -1083,6 +1091,9 @@ int mqtt_connect(struct mqtt_client *client);
  *                  Shall not be NULL.
  *
  * @return 0 or a negative error code (errno.h) indicating reason of failure.
+ *         -EAGAIN if CONFIG_MQTT_INFLIGHT_WINDOW is enabled and the maximum
+ *         number of QoS 1 and QoS 2 messages awaiting acknowledgment is
+ *         reached.
  */
 int mqtt_publish(struct mqtt_client *client,
 		 const struct mqtt_publish_param *param);
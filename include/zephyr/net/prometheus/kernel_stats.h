@@ -0,0 +1,34 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_PROMETHEUS_KERNEL_STATS_H_
+#define ZEPHYR_INCLUDE_PROMETHEUS_KERNEL_STATS_H_
+
+/**
+ * @file
+ *
+ * @brief Prometheus kernel statistics.
+ *
+ * @addtogroup prometheus
+ * @{
+ */
+
+#include <zephyr/net/prometheus/collector.h>
+
+/**
+ * @brief Collector exporting kernel statistics.
+ *
+ * Available with @kconfig{CONFIG_PROMETHEUS_KERNEL_STATS}. Its metrics are read from
+ * the kernel when the collector is formatted, for example with
+ * @ref prometheus_format_exposition.
+ */
+extern struct prometheus_collector kernel_stats_collector;
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_PROMETHEUS_KERNEL_STATS_H_ */
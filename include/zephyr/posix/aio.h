@@ -17,6 +17,17 @@
 extern "C" {
 #endif
 
+#define AIO_CANCELED    0
+#define AIO_NOTCANCELED 1
+#define AIO_ALLDONE     2
+
+#define LIO_READ  0
+#define LIO_WRITE 1
+#define LIO_NOP   2
+
+#define LIO_WAIT   0
+#define LIO_NOWAIT 1
+
 struct aiocb {
 	int aio_fildes;
 	off_t aio_offset;
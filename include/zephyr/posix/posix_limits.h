@@ -77,8 +77,10 @@
 #define NZERO      (20)
 
 /* Runtime invariant values */
-#define AIO_LISTIO_MAX                _POSIX_AIO_LISTIO_MAX
-#define AIO_MAX                       _POSIX_AIO_MAX
+#define AIO_LISTIO_MAX \
+	COND_CODE_1(CONFIG_POSIX_AIO_FILE_SYSTEM, (CONFIG_POSIX_AIO_MAX), (_POSIX_AIO_LISTIO_MAX))
+#define AIO_MAX \
+	COND_CODE_1(CONFIG_POSIX_AIO_FILE_SYSTEM, (CONFIG_POSIX_AIO_MAX), (_POSIX_AIO_MAX))
 #define AIO_PRIO_DELTA_MAX            (0)
 #define ARG_MAX                       _POSIX_ARG_MAX
 #define ATEXIT_MAX                    (32)
@@ -19,10 +19,14 @@
 #define ZVFS_O_APPEND 0x0400
 #define ZVFS_O_CREAT  0x0040
 #define ZVFS_O_TRUNC  0x0200
+#define ZVFS_O_DSYNC  0x1000
+#define ZVFS_O_SYNC   0x101000
 #else
 #define ZVFS_O_APPEND 0x0008
 #define ZVFS_O_CREAT  0x0200
 #define ZVFS_O_TRUNC  0x0400
+#define ZVFS_O_SYNC   0x2000
+#define ZVFS_O_DSYNC  ZVFS_O_SYNC
 #endif
 
 #define ZVFS_O_RDONLY 00
@@ -317,6 +317,13 @@ void z_sched_usage_stop(void);
 
 void z_sched_usage_start(struct k_thread *thread);
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+/**
+ * @brief Mark the start of the scheduling latency window of a thread
+ */
+void z_sched_usage_ready(struct k_thread *thread);
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+
 /**
  * @brief Retrieves CPU cycle usage data for specified core
  */
@@ -0,0 +1,44 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_KERNEL_INCLUDE_LOCK_STATS_H_
+#define ZEPHYR_KERNEL_INCLUDE_LOCK_STATS_H_
+
+#include <zephyr/kernel.h>
+
+/*
+ * Contention statistics helpers shared by the mutex and semaphore object
+ * core statistics. Callers are expected to hold the lock protecting the
+ * object.
+ */
+
+static inline void z_lock_stats_acquired(struct k_lock_stats *stats,
+					 struct k_thread *thread)
+{
+	stats->acquired++;
+	stats->holder = thread;
+}
+
+static inline void z_lock_stats_waited(struct k_lock_stats *stats,
+				       uint32_t cycles)
+{
+	stats->contended++;
+	stats->wait_cycles += cycles;
+
+	if (stats->max_wait_cycles < cycles) {
+		stats->max_wait_cycles = cycles;
+	}
+}
+
+static inline void z_lock_stats_reset(struct k_lock_stats *stats)
+{
+	stats->acquired = 0U;
+	stats->contended = 0U;
+	stats->wait_cycles = 0ULL;
+	stats->max_wait_cycles = 0U;
+}
+
+#endif /* ZEPHYR_KERNEL_INCLUDE_LOCK_STATS_H_ */
@@ -32,7 +32,9 @@
 #include <ksched.h>
 #include <kthread.h>
 #include <wait_q.h>
+#include <lock_stats.h>
 #include <errno.h>
+#include <string.h>
 #include <zephyr/init.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/tracing/tracing.h>
@@ -50,6 +52,48 @@ static struct k_spinlock lock;
 
 #ifdef CONFIG_OBJ_CORE_MUTEX
 static struct k_obj_type obj_type_mutex;
+
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+static int k_mutex_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	__ASSERT((obj_core != NULL) && (stats != NULL), "NULL parameter");
+
+	struct k_mutex *mutex;
+	k_spinlock_key_t key;
+
+	mutex = CONTAINER_OF(obj_core, struct k_mutex, obj_core);
+	key = k_spin_lock(&lock);
+	memcpy(stats, &mutex->stats, sizeof(mutex->stats));
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+static int k_mutex_stats_reset(struct k_obj_core *obj_core)
+{
+	__ASSERT(obj_core != NULL, "NULL parameter");
+
+	struct k_mutex *mutex;
+	k_spinlock_key_t key;
+
+	mutex = CONTAINER_OF(obj_core, struct k_mutex, obj_core);
+	key = k_spin_lock(&lock);
+	z_lock_stats_reset(&mutex->stats);
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+static struct k_obj_core_stats_desc mutex_stats_desc = {
+	.raw_size = sizeof(struct k_lock_stats),
+	.query_size = sizeof(struct k_lock_stats),
+	.raw   = k_mutex_stats_raw,
+	.query = k_mutex_stats_raw,
+	.reset = k_mutex_stats_reset,
+	.disable = NULL,
+	.enable = NULL,
+};
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
 #endif /* CONFIG_OBJ_CORE_MUTEX */
 
 int z_impl_k_mutex_init(struct k_mutex *mutex)
@@ -63,6 +107,11 @@ int z_impl_k_mutex_init(struct k_mutex *mutex)
 
 #ifdef CONFIG_OBJ_CORE_MUTEX
 	k_obj_core_init_and_link(K_OBJ_CORE(mutex), &obj_type_mutex);
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	memset(&mutex->stats, 0, sizeof(mutex->stats));
+	k_obj_core_stats_register(K_OBJ_CORE(mutex), &mutex->stats,
+				  sizeof(mutex->stats));
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
 #endif /* CONFIG_OBJ_CORE_MUTEX */
 
 	SYS_PORT_TRACING_OBJ_INIT(k_mutex, mutex, 0);
@@ -123,6 +172,10 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		mutex->lock_count++;
 		mutex->owner = _current;
 
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+		z_lock_stats_acquired(&mutex->stats, _current);
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
+
 		LOG_DBG("%p took mutex %p, count: %d, orig prio: %d",
 			_current, mutex, mutex->lock_count,
 			mutex->owner_orig_prio);
@@ -153,8 +206,21 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		resched = adjust_owner_prio(mutex, new_prio);
 	}
 
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	uint32_t wait_start = k_cycle_get_32();
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
+
 	int got_mutex = z_pend_curr(&lock, key, &mutex->wait_q, timeout);
 
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	K_SPINLOCK(&lock) {
+		z_lock_stats_waited(&mutex->stats, k_cycle_get_32() - wait_start);
+		if (got_mutex == 0) {
+			z_lock_stats_acquired(&mutex->stats, _current);
+		}
+	}
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
+
 	LOG_DBG("on mutex %p got_mutex value: %d", mutex, got_mutex);
 
 	LOG_DBG("%p got mutex %p (y/n): %c", _current, mutex,
@@ -300,10 +366,18 @@ static int init_mutex_obj_core_list(void)
 	z_obj_type_init(&obj_type_mutex, K_OBJ_TYPE_MUTEX_ID,
 			offsetof(struct k_mutex, obj_core));
 
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	k_obj_type_stats_init(&obj_type_mutex, &mutex_stats_desc);
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
+
 	/* Initialize and link statically defined mutexes */
 
 	STRUCT_SECTION_FOREACH(k_mutex, mutex) {
 		k_obj_core_init_and_link(K_OBJ_CORE(mutex), &obj_type_mutex);
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+		k_obj_core_stats_register(K_OBJ_CORE(mutex), &mutex->stats,
+					  sizeof(mutex->stats));
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
 	}
 
 	return 0;
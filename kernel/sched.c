@@ -357,6 +357,9 @@ static void ready_thread(struct k_thread *thread)
 	if (!z_is_thread_queued(thread) && z_is_thread_ready(thread)) {
 		SYS_PORT_TRACING_OBJ_FUNC(k_thread, sched_ready, thread);
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+		z_sched_usage_ready(thread);
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
 		queue_thread(thread);
 		update_cache(0);
 
@@ -24,10 +24,12 @@
 #include <wait_q.h>
 #include <zephyr/sys/dlist.h>
 #include <ksched.h>
+#include <lock_stats.h>
 #include <zephyr/init.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/tracing/tracing.h>
 #include <zephyr/sys/check.h>
+#include <string.h>
 
 /* We use a system-wide lock to synchronize semaphores, which has
  * unfortunate performance impact vs. using a per-object lock
@@ -40,6 +42,48 @@ static struct k_spinlock lock;
 
 #ifdef CONFIG_OBJ_CORE_SEM
 static struct k_obj_type obj_type_sem;
+
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+static int k_sem_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	__ASSERT((obj_core != NULL) && (stats != NULL), "NULL parameter");
+
+	struct k_sem *sem;
+	k_spinlock_key_t key;
+
+	sem = CONTAINER_OF(obj_core, struct k_sem, obj_core);
+	key = k_spin_lock(&lock);
+	memcpy(stats, &sem->stats, sizeof(sem->stats));
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+static int k_sem_stats_reset(struct k_obj_core *obj_core)
+{
+	__ASSERT(obj_core != NULL, "NULL parameter");
+
+	struct k_sem *sem;
+	k_spinlock_key_t key;
+
+	sem = CONTAINER_OF(obj_core, struct k_sem, obj_core);
+	key = k_spin_lock(&lock);
+	z_lock_stats_reset(&sem->stats);
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+static struct k_obj_core_stats_desc sem_stats_desc = {
+	.raw_size = sizeof(struct k_lock_stats),
+	.query_size = sizeof(struct k_lock_stats),
+	.raw   = k_sem_stats_raw,
+	.query = k_sem_stats_raw,
+	.reset = k_sem_stats_reset,
+	.disable = NULL,
+	.enable = NULL,
+};
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
 #endif /* CONFIG_OBJ_CORE_SEM */
 
 int z_impl_k_sem_init(struct k_sem *sem, unsigned int initial_count,
@@ -67,6 +111,11 @@ int z_impl_k_sem_init(struct k_sem *sem, unsigned int initial_count,
 
 #ifdef CONFIG_OBJ_CORE_SEM
 	k_obj_core_init_and_link(K_OBJ_CORE(sem), &obj_type_sem);
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	memset(&sem->stats, 0, sizeof(sem->stats));
+	k_obj_core_stats_register(K_OBJ_CORE(sem), &sem->stats,
+				  sizeof(sem->stats));
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
 #endif /* CONFIG_OBJ_CORE_SEM */
 
 	return 0;
@@ -142,6 +191,9 @@ int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 
 	if (likely(sem->count > 0U)) {
 		sem->count--;
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+		z_lock_stats_acquired(&sem->stats, _current);
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
 		k_spin_unlock(&lock, key);
 		ret = 0;
 		goto out;
@@ -155,8 +207,21 @@ int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_sem, take, sem, timeout);
 
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	uint32_t wait_start = k_cycle_get_32();
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
+
 	ret = z_pend_curr(&lock, key, &sem->wait_q, timeout);
 
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	K_SPINLOCK(&lock) {
+		z_lock_stats_waited(&sem->stats, k_cycle_get_32() - wait_start);
+		if (ret == 0) {
+			z_lock_stats_acquired(&sem->stats, _current);
+		}
+	}
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
+
 out:
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_sem, take, sem, timeout, ret);
 
@@ -223,10 +288,18 @@ static int init_sem_obj_core_list(void)
 	z_obj_type_init(&obj_type_sem, K_OBJ_TYPE_SEM_ID,
 			offsetof(struct k_sem, obj_core));
 
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	k_obj_type_stats_init(&obj_type_sem, &sem_stats_desc);
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
+
 	/* Initialize and link statically defined semaphores */
 
 	STRUCT_SECTION_FOREACH(k_sem, sem) {
 		k_obj_core_init_and_link(K_OBJ_CORE(sem), &obj_type_sem);
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+		k_obj_core_stats_register(K_OBJ_CORE(sem), &sem->stats,
+					  sizeof(sem->stats));
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
 	}
 
 	return 0;
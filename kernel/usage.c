@@ -10,6 +10,7 @@
 #include <ksched.h>
 #include <zephyr/spinlock.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/math_extras.h>
 
 /* Need one of these for this to work */
 #if !defined(CONFIG_USE_SWITCH) && !defined(CONFIG_INSTRUMENT_THREAD_SWITCHING)
@@ -71,6 +72,49 @@ static void sched_thread_update_usage(struct k_thread *thread, uint32_t cycles)
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+static void sched_latency_record(struct k_cycle_stats *stats, uint32_t cycles)
+{
+	uint32_t bucket = (cycles == 0U) ? 0U : 32U - u32_count_leading_zeros(cycles);
+
+	stats->latency[MIN(bucket, CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS - 1)]++;
+}
+
+static void sched_update_latency(struct k_thread *thread, uint32_t now)
+{
+	uint32_t ready = thread->base.usage.ready;
+
+	if (ready == 0U) {
+		/* No ready_thread() since the thread last ran: it was put back in
+		 * the run queue after being preempted or yielding, or requeued by
+		 * a priority change. Only wakeups, resumes and thread starts are
+		 * sampled.
+		 */
+		return;
+	}
+
+	thread->base.usage.ready = 0U;
+
+	if (thread->base.usage.track_usage) {
+		sched_latency_record(&thread->base.usage, now - ready);
+	}
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_ALL
+	if (_current_cpu->usage->track_usage) {
+		sched_latency_record(_current_cpu->usage, now - ready);
+	}
+#endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
+}
+
+void z_sched_usage_ready(struct k_thread *thread)
+{
+	/* A single store, the window is consumed by z_sched_usage_start()
+	 * on the CPU the thread is switched in on.
+	 */
+	thread->base.usage.ready = usage_now();
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+
 void z_sched_usage_start(struct k_thread *thread)
 {
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
@@ -85,6 +129,10 @@ void z_sched_usage_start(struct k_thread *thread)
 		thread->base.usage.current = 0;
 	}
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	sched_update_latency(thread, _current_cpu->usage0);
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+
 	k_spin_unlock(&usage_lock, key);
 #else
 	/* One write through a volatile pointer doesn't require
@@ -160,6 +208,10 @@ void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 	}
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	memcpy(stats->latency, cpu->usage->latency, sizeof(stats->latency));
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+
 	stats->idle_cycles =
 		_kernel.cpus[cpu_id].idle_thread->base.usage.total;
 
@@ -216,6 +268,10 @@ void z_sched_thread_usage(struct k_thread *thread,
 	}
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	memcpy(stats->latency, thread->base.usage.latency, sizeof(stats->latency));
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 	stats->idle_cycles = 0;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
@@ -381,6 +437,9 @@ int z_thread_stats_reset(struct k_obj_core *obj_core)
 	stats->longest = 0ULL;
 	stats->num_windows = (thread->base.usage.track_usage) ?  1U : 0U;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	memset(stats->latency, 0, sizeof(stats->latency));
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
 
 	if (thread != _current_cpu->current) {
 
@@ -9,6 +9,444 @@
 
 #include <zephyr/posix/aio.h>
 
+#ifdef CONFIG_POSIX_AIO_FILE_SYSTEM
+
+#include <zephyr/fs/fs.h>
+#include <zephyr/fs/fs_rtio.h>
+#include <zephyr/kernel.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/sys/fdtable.h>
+#include <zephyr/sys/timeutil.h>
+
+/*
+ * Each request is executed by the file system RTIO worker of the file's
+ * mount point. A request slot stays allocated from submission until its
+ * status has been reaped with aio_return().
+ */
+struct aio_req {
+	struct aiocb *aiocbp;
+	struct rtio_iodev iodev;
+	struct fs_rtio_file file;
+	int error;
+	ssize_t result;
+};
+
+/* Request code used internally for aio_fsync() */
+#define AIO_OP_FSYNC (-1)
+
+static struct aio_req aio_reqs[CONFIG_POSIX_AIO_MAX];
+RTIO_DEFINE(aio_rtio, CONFIG_POSIX_AIO_MAX, CONFIG_POSIX_AIO_MAX);
+static K_MUTEX_DEFINE(aio_lock);
+
+/* Record the status of completed requests, called with aio_lock held */
+static void aio_reap_completions(void)
+{
+	struct rtio_cqe *cqe;
+	struct aio_req *req;
+
+	while ((cqe = rtio_cqe_consume(&aio_rtio)) != NULL) {
+		req = cqe->userdata;
+
+		if (cqe->result < 0) {
+			req->error = -cqe->result;
+			req->result = -1;
+		} else {
+			req->error = 0;
+			req->result = cqe->result;
+		}
+
+		rtio_cqe_release(&aio_rtio, cqe);
+	}
+}
+
+/* Wait until a completion is pending, without consuming it */
+static int aio_wait_completion(k_timepoint_t end)
+{
+	if (k_sem_take(aio_rtio.consume_sem, sys_timepoint_timeout(end)) != 0) {
+		return -EAGAIN;
+	}
+
+	k_sem_give(aio_rtio.consume_sem);
+
+	return 0;
+}
+
+static struct aio_req *aio_req_find(const struct aiocb *aiocbp)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(aio_reqs); i++) {
+		if (aio_reqs[i].aiocbp == aiocbp) {
+			return &aio_reqs[i];
+		}
+	}
+
+	return NULL;
+}
+
+static size_t aio_req_free_count(void)
+{
+	size_t count = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(aio_reqs); i++) {
+		if (aio_reqs[i].aiocbp == NULL) {
+			count++;
+		}
+	}
+
+	return count;
+}
+
+static bool aio_sigevent_supported(const struct sigevent *sig)
+{
+	return (sig == NULL) || (sig->sigev_notify == SIGEV_NONE);
+}
+
+/* Queue one request, called with aio_lock held */
+static int aio_enqueue(struct aiocb *aiocbp, int opcode)
+{
+	const struct fd_op_vtable *vtable;
+	struct zvfs_stat stat;
+	struct fs_file_t *zfp;
+	struct k_mutex *lock;
+	struct rtio_sqe *sqe;
+	struct aio_req *req;
+	off_t offset;
+
+	if (!aio_sigevent_supported(&aiocbp->aio_sigevent)) {
+		return -EINVAL;
+	}
+
+	if ((opcode != AIO_OP_FSYNC) &&
+	    ((aiocbp->aio_offset < 0) || (aiocbp->aio_nbytes > INT32_MAX))) {
+		return -EINVAL;
+	}
+
+	if (aio_req_find(aiocbp) != NULL) {
+		/* The control block is still in use by a previous request */
+		return -EINVAL;
+	}
+
+	zfp = zvfs_get_fd_obj_and_vtable(aiocbp->aio_fildes, &vtable, &lock);
+	if (zfp == NULL) {
+		return -errno;
+	}
+
+	if ((zvfs_fstat(aiocbp->aio_fildes, &stat) != 0) ||
+	    ((stat.mode & ZVFS_MODE_IFMT) != ZVFS_MODE_IFREG)) {
+		/* Only regular files are backed by the file system RTIO device */
+		return -EINVAL;
+	}
+
+	req = aio_req_find(NULL);
+	sqe = (req != NULL) ? rtio_sqe_acquire(&aio_rtio) : NULL;
+	if (sqe == NULL) {
+		return -EAGAIN;
+	}
+
+	/* Writes to files opened for appending ignore the requested offset */
+	if ((opcode == LIO_WRITE) && ((zfp->flags & FS_O_APPEND) != 0)) {
+		offset = FS_RTIO_OFFSET_CURRENT;
+	} else {
+		offset = aiocbp->aio_offset;
+	}
+
+	fs_rtio_iodev_init(&req->iodev, &req->file, zfp, offset);
+	req->file.lock = lock;
+
+	switch (opcode) {
+	case LIO_READ:
+		rtio_sqe_prep_read(sqe, &req->iodev, RTIO_PRIO_NORM, (uint8_t *)aiocbp->aio_buf,
+				   aiocbp->aio_nbytes, req);
+		break;
+	case LIO_WRITE:
+		rtio_sqe_prep_write(sqe, &req->iodev, RTIO_PRIO_NORM,
+				    (const uint8_t *)aiocbp->aio_buf, aiocbp->aio_nbytes, req);
+		break;
+	default:
+		fs_rtio_sqe_prep_sync(sqe, &req->iodev, req);
+		break;
+	}
+
+	req->aiocbp = aiocbp;
+	req->error = EINPROGRESS;
+	req->result = -1;
+
+	return 0;
+}
+
+static int aio_submit(struct aiocb *aiocbp, int opcode)
+{
+	int ret;
+
+	if (aiocbp == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	k_mutex_lock(&aio_lock, K_FOREVER);
+
+	aio_reap_completions();
+
+	ret = aio_enqueue(aiocbp, opcode);
+	if (ret == 0) {
+		(void)rtio_submit(&aio_rtio, 0);
+	}
+
+	k_mutex_unlock(&aio_lock);
+
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return 0;
+}
+
+/* Check whether all (all == true) or any listed request completed */
+static bool aio_list_done(const struct aiocb *const list[], int nent, bool all)
+{
+	const struct aio_req *req;
+	bool done;
+
+	for (int i = 0; i < nent; i++) {
+		if (list[i] == NULL) {
+			continue;
+		}
+
+		req = aio_req_find(list[i]);
+		done = (req == NULL) || (req->error != EINPROGRESS);
+
+		if (done != all) {
+			return done;
+		}
+	}
+
+	return all;
+}
+
+static int aio_list_wait(const struct aiocb *const list[], int nent, bool all, k_timepoint_t end)
+{
+	bool done;
+
+	while (true) {
+		k_mutex_lock(&aio_lock, K_FOREVER);
+		aio_reap_completions();
+		done = aio_list_done(list, nent, all);
+		k_mutex_unlock(&aio_lock);
+
+		if (done) {
+			return 0;
+		}
+
+		if (aio_wait_completion(end) != 0) {
+			return -EAGAIN;
+		}
+	}
+}
+
+int aio_cancel(int fildes, struct aiocb *aiocbp)
+{
+	const struct fd_op_vtable *vtable;
+	bool in_progress = false;
+	int ret;
+
+	if ((aiocbp != NULL) && (aiocbp->aio_fildes != fildes)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (zvfs_get_fd_obj_and_vtable(fildes, &vtable, NULL) == NULL) {
+		return -1;
+	}
+
+	k_mutex_lock(&aio_lock, K_FOREVER);
+
+	aio_reap_completions();
+
+	/* Requests being executed by the file system cannot be withdrawn */
+	for (size_t i = 0; i < ARRAY_SIZE(aio_reqs); i++) {
+		const struct aiocb *req_aiocbp = aio_reqs[i].aiocbp;
+
+		if ((req_aiocbp == NULL) || (aio_reqs[i].error != EINPROGRESS)) {
+			continue;
+		}
+
+		if ((aiocbp == NULL) ? (req_aiocbp->aio_fildes == fildes) : (req_aiocbp == aiocbp)) {
+			in_progress = true;
+		}
+	}
+
+	ret = in_progress ? AIO_NOTCANCELED : AIO_ALLDONE;
+
+	k_mutex_unlock(&aio_lock);
+
+	return ret;
+}
+
+int aio_error(const struct aiocb *aiocbp)
+{
+	const struct aio_req *req;
+	int ret;
+
+	k_mutex_lock(&aio_lock, K_FOREVER);
+
+	aio_reap_completions();
+
+	req = (aiocbp != NULL) ? aio_req_find(aiocbp) : NULL;
+	ret = (req != NULL) ? req->error : -1;
+
+	k_mutex_unlock(&aio_lock);
+
+	if (ret < 0) {
+		errno = EINVAL;
+	}
+
+	return ret;
+}
+
+int aio_fsync(int op, struct aiocb *aiocbp)
+{
+	/* O_SYNC and O_DSYNC requests are both completed by fs_sync() */
+	if ((op != ZVFS_O_SYNC) && (op != ZVFS_O_DSYNC)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	return aio_submit(aiocbp, AIO_OP_FSYNC);
+}
+
+int aio_read(struct aiocb *aiocbp)
+{
+	return aio_submit(aiocbp, LIO_READ);
+}
+
+ssize_t aio_return(struct aiocb *aiocbp)
+{
+	struct aio_req *req;
+	ssize_t ret = -1;
+	int error = EINVAL;
+
+	k_mutex_lock(&aio_lock, K_FOREVER);
+
+	aio_reap_completions();
+
+	req = (aiocbp != NULL) ? aio_req_find(aiocbp) : NULL;
+	if ((req != NULL) && (req->error != EINPROGRESS)) {
+		ret = req->result;
+		error = req->error;
+		req->aiocbp = NULL;
+	}
+
+	k_mutex_unlock(&aio_lock);
+
+	if (ret < 0) {
+		errno = error;
+	}
+
+	return ret;
+}
+
+int aio_suspend(const struct aiocb *const list[], int nent, const struct timespec *timeout)
+{
+	k_timepoint_t end;
+	int ret;
+
+	if ((list == NULL) || (nent < 0) || ((timeout != NULL) && !timespec_is_valid(timeout))) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	end = sys_timepoint_calc((timeout == NULL) ? K_FOREVER : timespec_to_timeout(timeout, NULL));
+
+	ret = aio_list_wait(list, nent, false, end);
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return 0;
+}
+
+int aio_write(struct aiocb *aiocbp)
+{
+	return aio_submit(aiocbp, LIO_WRITE);
+}
+
+int lio_listio(int mode, struct aiocb *const ZRESTRICT list[], int nent,
+	       struct sigevent *ZRESTRICT sig)
+{
+	size_t count = 0;
+	bool failed = false;
+	int ret;
+
+	if (((mode != LIO_WAIT) && (mode != LIO_NOWAIT)) || (list == NULL) || (nent < 0) ||
+	    (nent > CONFIG_POSIX_AIO_MAX) || ((mode == LIO_NOWAIT) && !aio_sigevent_supported(sig))) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	k_mutex_lock(&aio_lock, K_FOREVER);
+
+	aio_reap_completions();
+
+	for (int i = 0; i < nent; i++) {
+		if ((list[i] != NULL) && (list[i]->aio_lio_opcode != LIO_NOP)) {
+			count++;
+		}
+	}
+
+	/* Either queue every request or none of them */
+	if (count > aio_req_free_count()) {
+		k_mutex_unlock(&aio_lock);
+		errno = EAGAIN;
+		return -1;
+	}
+
+	for (int i = 0; i < nent; i++) {
+		if ((list[i] == NULL) || (list[i]->aio_lio_opcode == LIO_NOP)) {
+			continue;
+		}
+
+		if ((list[i]->aio_lio_opcode != LIO_READ) &&
+		    (list[i]->aio_lio_opcode != LIO_WRITE)) {
+			failed = true;
+			continue;
+		}
+
+		if (aio_enqueue(list[i], list[i]->aio_lio_opcode) < 0) {
+			failed = true;
+		}
+	}
+
+	(void)rtio_submit(&aio_rtio, 0);
+
+	k_mutex_unlock(&aio_lock);
+
+	if (mode == LIO_WAIT) {
+		ret = aio_list_wait((const struct aiocb *const *)list, nent, true,
+				    sys_timepoint_calc(K_FOREVER));
+		if (ret < 0) {
+			errno = -ret;
+			return -1;
+		}
+
+		for (int i = 0; (i < nent) && !failed; i++) {
+			if ((list[i] != NULL) && (list[i]->aio_lio_opcode != LIO_NOP) &&
+			    (aio_error(list[i]) != 0)) {
+				failed = true;
+			}
+		}
+	}
+
+	if (failed) {
+		errno = EIO;
+		return -1;
+	}
+
+	return 0;
+}
+
+#else /* CONFIG_POSIX_AIO_FILE_SYSTEM */
+
 int aio_cancel(int fildes, struct aiocb *aiocbp)
 {
 	ARG_UNUSED(fildes);
@@ -80,3 +518,5 @@ int lio_listio(int mode, struct aiocb *const ZRESTRICT list[], int nent,
 	errno = ENOSYS;
 	return -1;
 }
+
+#endif /* CONFIG_POSIX_AIO_FILE_SYSTEM */
@@ -18,6 +18,7 @@
 #include <zephyr/net/prometheus/gauge.h>
 #include <zephyr/net/prometheus/histogram.h>
 #include <zephyr/net/prometheus/summary.h>
+#include <zephyr/net/prometheus/kernel_stats.h>
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -36,6 +37,12 @@ struct app_context {
 
 } prom_context;
 
+#if defined(CONFIG_PROMETHEUS_KERNEL_STATS)
+#define PROM_BUFFER_SIZE 1536
+#else
+#define PROM_BUFFER_SIZE 256
+#endif
+
 #if defined(CONFIG_NET_SAMPLE_HTTP_SERVICE)
 static uint16_t test_http_service_port = CONFIG_NET_SAMPLE_HTTP_SERVER_SERVICE_PORT;
 HTTP_SERVICE_DEFINE(test_http_service, CONFIG_NET_CONFIG_MY_IPV4_ADDR, &test_http_service_port,
@@ -46,7 +53,7 @@ static int dyn_handler(struct http_client_ctx *client, enum http_transaction_sta
 		       struct http_response_ctx *response_ctx, void *user_data)
 {
 	int ret;
-	static uint8_t prom_buffer[256];
+	static uint8_t prom_buffer[PROM_BUFFER_SIZE];
 
 	if (status == HTTP_SERVER_REQUEST_DATA_FINAL) {
 
@@ -64,6 +71,17 @@ static int dyn_handler(struct http_client_ctx *client, enum http_transaction_sta
 			return ret;
 		}
 
+#if defined(CONFIG_PROMETHEUS_KERNEL_STATS)
+		size_t len = strlen(prom_buffer);
+
+		ret = prometheus_format_exposition(&kernel_stats_collector, prom_buffer + len,
+						   sizeof(prom_buffer) - len);
+		if (ret < 0) {
+			LOG_ERR("Cannot format kernel statistics (%d)", ret);
+			return ret;
+		}
+#endif
+
 		response_ctx->body = prom_buffer;
 		response_ctx->body_len = strlen(prom_buffer);
 		response_ctx->final_chunk = true;
@@ -6,6 +6,7 @@
 
 import logging
 import re
+import time
 
 from twister_harness import DeviceAdapter, Shell
 
@@ -33,6 +34,44 @@ def test_shell_perf(dut: DeviceAdapter, shell: Shell):
     assert length == len(lines), 'length dose not match with count of lines'
 
     i = 0
+    max_depth = 0
     while i < length:
-        i += int(lines[i], 16) + 1
+        depth = int(lines[i], 16)
+        max_depth = max(max_depth, depth)
+        i += depth + 1
         assert i <= length, 'one of the samples is not true to size'
+
+    # The sampled functions are called from main(), so the unwinder must
+    # get past the interrupted function.
+    assert max_depth > 1, 'no sample is deeper than one frame'
+
+
+def test_shell_perf_aggregate(dut: DeviceAdapter, shell: Shell):
+
+    shell.base_timeout=10
+
+    logger.info('send "perf record 0 99" command')
+    lines = shell.exec_command('perf record 0 99')
+    assert 'Enabled perf (continuous)' in lines, 'expected response not found'
+    time.sleep(2)
+    lines = shell.exec_command('perf stop')
+    assert 'Perf stopped' in lines, 'expected response not found'
+    logger.info('response is valid')
+
+    logger.info('send "perf printbuf" command')
+    lines = shell.exec_command('perf printbuf')
+    stacks = {}
+    for line in lines:
+        match = re.fullmatch(r"(\S+) (\d+)", line.strip())
+        if match is not None:
+            stacks[match.group(1)] = int(match.group(2))
+    assert len(stacks) != 0, 'no folded stacks found'
+    assert all(count != 0 for count in stacks.values()), 'stack with 0 samples'
+
+    # Frames are named with symtab, and the sampled functions are called
+    # from main(), so some stack must hold both.
+    def from_main(stack):
+        frames = stack.split(';')
+        return 'main' in frames and any(frame.startswith('func_') for frame in frames)
+
+    assert any(from_main(stack) for stack in stacks), 'no stack goes through main'
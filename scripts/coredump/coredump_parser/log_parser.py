@@ -26,6 +26,9 @@ COREDUMP_MEM_HDR_VER = 1
 LOG_MEM_HDR_STRUCT = "<cH"
 LOG_MEM_HDR_SIZE = struct.calcsize(LOG_MEM_HDR_STRUCT)
 
+COREDUMP_FILL_MEM_HDR_ID = b'F'
+COREDUMP_FILL_MEM_HDR_VER = 1
+
 
 logger = logging.getLogger("parser")
 
@@ -129,6 +132,39 @@ class CoredumpLogFile:
 
         return True
 
+    def parse_fill_memory_section(self):
+        hdr = self.fd.read(LOG_MEM_HDR_SIZE)
+        _, hdr_ver = struct.unpack(LOG_MEM_HDR_STRUCT, hdr)
+
+        if hdr_ver != COREDUMP_FILL_MEM_HDR_VER:
+            logger.error(
+                f"Fill memory block version: {hdr_ver}, expected {COREDUMP_FILL_MEM_HDR_VER}!"
+            )
+            return False
+
+        # Figure out how to read the start and end addresses
+        ptr_fmt = None
+        if self.log_hdr["ptr_size"] == 64:
+            ptr_fmt = "QQB"
+        elif self.log_hdr["ptr_size"] == 32:
+            ptr_fmt = "IIB"
+        else:
+            return False
+
+        data = self.fd.read(struct.calcsize(ptr_fmt))
+        saddr, eaddr, fill = struct.unpack(ptr_fmt, data)
+
+        size = eaddr - saddr
+
+        mem = {"start": saddr, "end": eaddr, "data": bytes([fill]) * size}
+        self.memory_regions.append(mem)
+
+        logger.info(
+            f"Memory: 0x{saddr:x} to 0x{eaddr:x} of size {size:d} filled with 0x{fill:02x}"
+        )
+
+        return True
+
     def parse(self):
         if self.fd is None:
             self.open()
@@ -179,6 +215,10 @@ class CoredumpLogFile:
                 if not self.parse_memory_section():
                     logger.error("Cannot parse memory section")
                     return False
+            elif section_id == COREDUMP_FILL_MEM_HDR_ID:
+                if not self.parse_fill_memory_section():
+                    logger.error("Cannot parse fill memory section")
+                    return False
             else:
                 # Unknown section in log file
                 logger.error(f"Unknown section in log file with ID {section_id}")
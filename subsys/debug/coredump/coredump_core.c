@@ -255,24 +255,34 @@ void coredump_buffer_output(uint8_t *buf, size_t buflen)
 	backend_api->buffer_output(buf, buflen);
 }
 
-void coredump_memory_dump(uintptr_t start_addr, uintptr_t end_addr)
+static void dump_memory_block(uintptr_t start_addr, uintptr_t end_addr)
 {
 	struct coredump_mem_hdr_t m;
-	size_t len;
 
-	if ((start_addr == POINTER_TO_UINT(NULL)) ||
-	    (end_addr == POINTER_TO_UINT(NULL))) {
-		return;
-	}
+	m.id = COREDUMP_MEM_HDR_ID;
+	m.hdr_version = COREDUMP_MEM_HDR_VER;
 
-	if (start_addr >= end_addr) {
-		return;
+	if (sizeof(uintptr_t) == 8) {
+		m.start	= sys_cpu_to_le64(start_addr);
+		m.end = sys_cpu_to_le64(end_addr);
+	} else if (sizeof(uintptr_t) == 4) {
+		m.start	= sys_cpu_to_le32(start_addr);
+		m.end = sys_cpu_to_le32(end_addr);
 	}
 
-	len = end_addr - start_addr;
+	coredump_buffer_output((uint8_t *)&m, sizeof(m));
 
-	m.id = COREDUMP_MEM_HDR_ID;
-	m.hdr_version = COREDUMP_MEM_HDR_VER;
+	coredump_buffer_output((uint8_t *)start_addr, end_addr - start_addr);
+}
+
+#ifdef CONFIG_DEBUG_COREDUMP_MEMORY_FILL_ELIDE
+static void dump_fill_block(uintptr_t start_addr, uintptr_t end_addr, uint8_t fill)
+{
+	struct coredump_fill_mem_hdr_t m;
+
+	m.id = COREDUMP_FILL_MEM_HDR_ID;
+	m.hdr_version = COREDUMP_FILL_MEM_HDR_VER;
+	m.fill = fill;
 
 	if (sizeof(uintptr_t) == 8) {
 		m.start	= sys_cpu_to_le64(start_addr);
@@ -283,8 +293,68 @@ void coredump_memory_dump(uintptr_t start_addr, uintptr_t end_addr)
 	}
 
 	coredump_buffer_output((uint8_t *)&m, sizeof(m));
+}
+
+/* Return the end of the run of words starting at addr where every byte is
+ * equal to the first byte of the run.
+ */
+static uintptr_t fill_run_end(uintptr_t addr, uintptr_t end_addr, uint8_t fill)
+{
+	uintptr_t pattern = (UINTPTR_MAX / 0xFFU) * fill;
 
-	coredump_buffer_output((uint8_t *)start_addr, len);
+	while (((end_addr - addr) >= sizeof(uintptr_t)) &&
+	       (*(uintptr_t *)addr == pattern)) {
+		addr += sizeof(uintptr_t);
+	}
+
+	return addr;
+}
+
+static void dump_memory_elide_fill(uintptr_t start_addr, uintptr_t end_addr)
+{
+	uintptr_t data_start = start_addr;
+	uintptr_t addr = ROUND_UP(start_addr, sizeof(uintptr_t));
+	uintptr_t run_end;
+	uint8_t fill;
+
+	while ((addr < end_addr) && ((end_addr - addr) >= sizeof(uintptr_t))) {
+		fill = *(uint8_t *)addr;
+		run_end = fill_run_end(addr, end_addr, fill);
+
+		if ((run_end - addr) >= CONFIG_DEBUG_COREDUMP_MEMORY_FILL_ELIDE_MIN) {
+			if (data_start < addr) {
+				dump_memory_block(data_start, addr);
+			}
+
+			dump_fill_block(addr, run_end, fill);
+			data_start = run_end;
+		}
+
+		addr = MAX(run_end, addr + sizeof(uintptr_t));
+	}
+
+	if (data_start < end_addr) {
+		dump_memory_block(data_start, end_addr);
+	}
+}
+#endif /* CONFIG_DEBUG_COREDUMP_MEMORY_FILL_ELIDE */
+
+void coredump_memory_dump(uintptr_t start_addr, uintptr_t end_addr)
+{
+	if ((start_addr == POINTER_TO_UINT(NULL)) ||
+	    (end_addr == POINTER_TO_UINT(NULL))) {
+		return;
+	}
+
+	if (start_addr >= end_addr) {
+		return;
+	}
+
+#ifdef CONFIG_DEBUG_COREDUMP_MEMORY_FILL_ELIDE
+	dump_memory_elide_fill(start_addr, end_addr);
+#else
+	dump_memory_block(start_addr, end_addr);
+#endif
 }
 
 int coredump_query(enum coredump_query_id query_id, void *arg)
@@ -416,6 +416,38 @@ static int parse_and_print_coredump(const struct shell *sh,
 			    (void *)hdr->start, (void *)hdr->end);
 		break;
 	}
+	case COREDUMP_FILL_MEM_HDR_ID: {
+		struct coredump_fill_mem_hdr_t *hdr;
+
+		copy->length = sizeof(struct coredump_fill_mem_hdr_t);
+		if (copy->length > left_size) {
+			return -ENOMEM;
+		}
+
+		ret = coredump_cmd(COREDUMP_CMD_COPY_STORED_DUMP, copy);
+		if (ret != 0) {
+			return -ENOMEM;
+		}
+
+		hdr = (struct coredump_fill_mem_hdr_t *)copy->buffer;
+
+		if (sizeof(uintptr_t) == 8) {
+			hdr->start = sys_le64_to_cpu(hdr->start);
+			hdr->end = sys_le64_to_cpu(hdr->end);
+		} else {
+			hdr->start = sys_le32_to_cpu(hdr->start);
+			hdr->end = sys_le32_to_cpu(hdr->end);
+		}
+
+		/* No data follows, the content is a single repeated byte */
+		shell_print(sh, "-> Fill memory coredump header found");
+		shell_print(sh, "\tVersion %u", hdr->hdr_version);
+		shell_print(sh, "\tSize %u", (unsigned int)(hdr->end - hdr->start));
+		shell_print(sh, "\tStarts at %p ends at %p",
+			    (void *)hdr->start, (void *)hdr->end);
+		shell_print(sh, "\tFilled with 0x%02x", hdr->fill);
+		break;
+	}
 	default:
 		return -EINVAL;
 	}
@@ -63,6 +63,56 @@ BUILD_ASSERT((CONFIG_IMG_BLOCK_BUF_SIZE % FLASH_WRITE_BLOCK_SIZE == 0),
 #define FLASH_CHECK_ERASED_BUFFER_SIZE 16
 #define ERASED_VAL_32(x) (((x) << 24) | ((x) << 16) | ((x) << 8) | (x))
 
+#ifdef CONFIG_IMG_STREAM_HASH
+enum {
+	FLASH_IMG_HASH_NONE,
+	FLASH_IMG_HASH_RUNNING,
+	FLASH_IMG_HASH_DONE,
+};
+
+static void flash_img_hash_start(struct flash_img_context *ctx)
+{
+	ctx->hash_op = psa_hash_operation_init();
+	ctx->hash_len = 0;
+	ctx->hash_state = FLASH_IMG_HASH_NONE;
+
+	if (psa_hash_setup(&ctx->hash_op, PSA_ALG_SHA_256) == PSA_SUCCESS) {
+		ctx->hash_state = FLASH_IMG_HASH_RUNNING;
+	}
+}
+
+static void flash_img_hash_update(struct flash_img_context *ctx, const uint8_t *data,
+				  size_t len, bool flush, int write_rc)
+{
+	size_t hash_len;
+
+	if (ctx->hash_state != FLASH_IMG_HASH_RUNNING) {
+		return;
+	}
+
+	/* Data that could not be written invalidates the hash */
+	if ((write_rc != 0) ||
+	    ((len > 0) && (psa_hash_update(&ctx->hash_op, data, len) != PSA_SUCCESS))) {
+		goto fail;
+	}
+	ctx->hash_len += len;
+
+	if (flush) {
+		if (psa_hash_finish(&ctx->hash_op, ctx->hash, sizeof(ctx->hash),
+				    &hash_len) != PSA_SUCCESS) {
+			goto fail;
+		}
+		ctx->hash_state = FLASH_IMG_HASH_DONE;
+	}
+
+	return;
+
+fail:
+	psa_hash_abort(&ctx->hash_op);
+	ctx->hash_state = FLASH_IMG_HASH_NONE;
+}
+#endif /* CONFIG_IMG_STREAM_HASH */
+
 static int scramble_mcuboot_trailer(struct flash_img_context *ctx)
 {
 	int rc = 0;
@@ -124,6 +174,9 @@ int flash_img_buffered_write(struct flash_img_context *ctx, const uint8_t *data,
 	 */
 	rc = scramble_mcuboot_trailer(ctx);
 	if (rc != 0) {
+#ifdef CONFIG_IMG_STREAM_HASH
+		flash_img_hash_update(ctx, data, len, flush, rc);
+#endif
 		return rc;
 	}
 
@@ -132,6 +185,9 @@ int flash_img_buffered_write(struct flash_img_context *ctx, const uint8_t *data,
 	 * ensures that stream_flash erases flash progresively.
 	 */
 	rc = stream_flash_buffered_write(&ctx->stream, data, len, flush);
+#ifdef CONFIG_IMG_STREAM_HASH
+	flash_img_hash_update(ctx, data, len, flush, rc);
+#endif
 	if (!flush) {
 		return rc;
 	}
@@ -214,6 +270,10 @@ int flash_img_init_id(struct flash_img_context *ctx, uint8_t area_id)
 
 	flash_dev = flash_area_get_device(ctx->flash_area);
 
+#ifdef CONFIG_IMG_STREAM_HASH
+	flash_img_hash_start(ctx);
+#endif
+
 #if defined(CONFIG_MCUBOOT_BOOTLOADER_MODE_SWAP_USING_OFFSET)
 	/* Query size of first sector in flash for upgrade slot, so it can be erased, and begin
 	 * upload started at the second sector
@@ -311,3 +371,23 @@ int flash_img_check(struct flash_img_context *ctx,
 	return rc;
 }
 #endif
+
+#if defined(CONFIG_IMG_STREAM_HASH)
+int flash_img_check_hash(struct flash_img_context *ctx,
+			 const struct flash_img_check *fic)
+{
+	if (!ctx || !fic || !fic->match) {
+		return -EINVAL;
+	}
+
+	if ((ctx->hash_state != FLASH_IMG_HASH_DONE) || (ctx->hash_len != fic->clen)) {
+		return -ENODATA;
+	}
+
+	if (memcmp(ctx->hash, fic->match, sizeof(ctx->hash))) {
+		return -EILSEQ;
+	}
+
+	return 0;
+}
+#endif
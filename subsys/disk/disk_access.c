@@ -14,6 +14,8 @@
 #include <errno.h>
 #include <zephyr/device.h>
 
+#include "disk_cache.h"
+
 #define LOG_LEVEL CONFIG_DISK_LOG_LEVEL
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(disk);
@@ -54,6 +56,17 @@ struct disk_info *disk_access_get_di(const char *name)
 	return disk;
 }
 
+static int disk_access_cache_detach(struct disk_info *disk)
+{
+#ifdef CONFIG_DISK_ACCESS_CACHE
+	return disk_cache_detach(disk);
+#else
+	ARG_UNUSED(disk);
+
+	return 0;
+#endif
+}
+
 int disk_access_init(const char *pdrv)
 {
 	struct disk_info *disk = disk_access_get_di(pdrv);
@@ -98,7 +111,11 @@ int disk_access_read(const char *pdrv, uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->read != NULL)) {
+#ifdef CONFIG_DISK_ACCESS_CACHE
+		rc = disk_cache_read(disk, data_buf, start_sector, num_sector);
+#else
 		rc = disk->ops->read(disk, data_buf, start_sector, num_sector);
+#endif
 	}
 
 	return rc;
@@ -112,7 +129,11 @@ int disk_access_write(const char *pdrv, const uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->write != NULL)) {
+#ifdef CONFIG_DISK_ACCESS_CACHE
+		rc = disk_cache_write(disk, data_buf, start_sector, num_sector);
+#else
 		rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+#endif
 	}
 
 	return rc;
@@ -143,6 +164,12 @@ int disk_access_erase(const char *pdrv, uint32_t start_sector, uint32_t num_sect
 
 	if ((disk != NULL) && (disk->ops != NULL) && (disk->ops->erase != NULL)) {
 		rc = disk->ops->erase(disk, start_sector, num_sector);
+#ifdef CONFIG_DISK_ACCESS_CACHE
+		if (rc == 0) {
+			/* Dirty sectors must not overwrite the erased range later */
+			disk_cache_invalidate(disk, start_sector, num_sector);
+		}
+#endif
 	}
 
 	return rc;
@@ -172,10 +199,17 @@ int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buf)
 		case DISK_IOCTL_CTRL_DEINIT:
 			if ((buf != NULL) && (*((bool *)buf))) {
 				/* Force deinit disk */
+				rc = disk_access_cache_detach(disk);
+				if (rc != 0) {
+					break;
+				}
 				disk->refcnt = 0U;
 				disk->ops->ioctl(disk, cmd, buf);
-				rc = 0;
 			} else if (disk->refcnt == 1U) {
+				rc = disk_access_cache_detach(disk);
+				if (rc != 0) {
+					break;
+				}
 				rc = disk->ops->ioctl(disk, cmd, buf);
 				if (rc == 0) {
 					disk->refcnt--;
@@ -187,6 +221,14 @@ int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buf)
 				LOG_WRN("Disk is already deinitialized");
 			}
 			break;
+#ifdef CONFIG_DISK_ACCESS_CACHE
+		case DISK_IOCTL_CTRL_SYNC:
+			rc = disk_cache_flush(disk);
+			if (rc == 0) {
+				rc = disk->ops->ioctl(disk, cmd, buf);
+			}
+			break;
+#endif
 		default:
 			rc = disk->ops->ioctl(disk, cmd, buf);
 		}
@@ -211,6 +253,9 @@ int disk_access_register(struct disk_info *disk)
 
 	/* Initialize reference count to zero */
 	disk->refcnt = 0U;
+#ifdef CONFIG_DISK_ACCESS_CACHE
+	disk->cache_state = 0U;
+#endif
 
 	spinlock_key = k_spin_lock(&lock);
 	/*  append to the disk list */
@@ -223,6 +268,7 @@ int disk_access_register(struct disk_info *disk)
 int disk_access_unregister(struct disk_info *disk)
 {
 	k_spinlock_key_t spinlock_key;
+	int rc;
 
 	if ((disk == NULL) || (disk->name == NULL)) {
 		LOG_ERR("invalid disk interface!!");
@@ -234,6 +280,12 @@ int disk_access_unregister(struct disk_info *disk)
 		return -EINVAL;
 	}
 
+	rc = disk_access_cache_detach(disk);
+	if (rc != 0) {
+		LOG_ERR("disk interface(%s) cache write back failed", disk->name);
+		return rc;
+	}
+
 	spinlock_key = k_spin_lock(&lock);
 	/* remove disk node from the list */
 	sys_dlist_remove(&disk->node);
@@ -0,0 +1,397 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/storage/disk_access.h>
+
+#include "disk_cache.h"
+
+#define LOG_LEVEL CONFIG_DISK_LOG_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(disk);
+
+#define CACHE_SECTOR_SIZE CONFIG_DISK_ACCESS_CACHE_SECTOR_SIZE
+#define CACHE_XFER_SECTORS CONFIG_DISK_ACCESS_CACHE_XFER_SECTORS
+
+struct disk_cache_block {
+	/* LRU list node, least recently used block first */
+	sys_dnode_t node;
+	/* Disk the cached sector belongs to, NULL if the block is free */
+	struct disk_info *disk;
+	uint32_t sector;
+	bool dirty;
+	uint8_t data[CACHE_SECTOR_SIZE] __aligned(4);
+};
+
+static struct disk_cache_block cache_blocks[CONFIG_DISK_ACCESS_CACHE_BLOCKS];
+static sys_dlist_t cache_lru = SYS_DLIST_STATIC_INIT(&cache_lru);
+static K_MUTEX_DEFINE(cache_lock);
+
+/* Staging buffers for multi-sector read-ahead and coalesced write-back. They
+ * are separate because storing read-ahead sectors may evict and write back
+ * dirty blocks.
+ */
+static uint8_t cache_fetch_buf[CACHE_XFER_SECTORS * CACHE_SECTOR_SIZE] __aligned(4);
+static uint8_t cache_flush_buf[CACHE_XFER_SECTORS * CACHE_SECTOR_SIZE] __aligned(4);
+
+/* End of the last read, used to detect sequential access */
+static struct disk_info *stream_disk;
+static uint32_t stream_next_sector;
+
+/* Values of disk_info::cache_state */
+enum {
+	CACHE_STATE_UNKNOWN = 0,
+	CACHE_STATE_CACHED,
+	CACHE_STATE_BYPASS,
+};
+
+static bool disk_cache_usable(struct disk_info *disk)
+{
+	uint32_t sector_size;
+
+	if (disk->cache_state != CACHE_STATE_UNKNOWN) {
+		return disk->cache_state == CACHE_STATE_CACHED;
+	}
+
+	/* Query the sector size once. A failed query is retried on next use,
+	 * the disk may not be initialized yet.
+	 */
+	if ((disk->ops->ioctl == NULL) ||
+	    (disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_SIZE, &sector_size) != 0)) {
+		return false;
+	}
+
+	disk->cache_state = (sector_size == CACHE_SECTOR_SIZE) ? CACHE_STATE_CACHED :
+								  CACHE_STATE_BYPASS;
+
+	return disk->cache_state == CACHE_STATE_CACHED;
+}
+
+static int disk_cache_sector_count(struct disk_info *disk, uint32_t *count)
+{
+	return disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_COUNT, count);
+}
+
+static struct disk_cache_block *cache_find(struct disk_info *disk, uint32_t sector)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(cache_blocks); i++) {
+		if ((cache_blocks[i].disk == disk) && (cache_blocks[i].sector == sector)) {
+			return &cache_blocks[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void cache_touch(struct disk_cache_block *block)
+{
+	sys_dlist_remove(&block->node);
+	sys_dlist_append(&cache_lru, &block->node);
+}
+
+static void cache_drop(struct disk_cache_block *block)
+{
+	block->disk = NULL;
+	block->dirty = false;
+
+	/* Free blocks are reused first */
+	sys_dlist_remove(&block->node);
+	sys_dlist_prepend(&cache_lru, &block->node);
+}
+
+/* Write back the run of consecutive dirty sectors containing block */
+static int cache_flush_run(struct disk_cache_block *block)
+{
+	struct disk_info *disk = block->disk;
+	struct disk_cache_block *run[CACHE_XFER_SECTORS];
+	struct disk_cache_block *other;
+	uint32_t start = block->sector;
+	size_t count = 0;
+	int rc;
+
+	while ((start > 0) && ((block->sector - start) < (CACHE_XFER_SECTORS - 1))) {
+		other = cache_find(disk, start - 1);
+		if ((other == NULL) || !other->dirty) {
+			break;
+		}
+		start--;
+	}
+
+	while (count < CACHE_XFER_SECTORS) {
+		other = cache_find(disk, start + count);
+		if ((other == NULL) || !other->dirty) {
+			break;
+		}
+
+		memcpy(&cache_flush_buf[count * CACHE_SECTOR_SIZE], other->data,
+		       CACHE_SECTOR_SIZE);
+		run[count++] = other;
+	}
+
+	rc = disk->ops->write(disk, cache_flush_buf, start, count);
+	if (rc != 0) {
+		LOG_ERR("Write back of %zu sectors at %u failed (%d)", count, start, rc);
+		return rc;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		run[i]->dirty = false;
+	}
+
+	return 0;
+}
+
+static struct disk_cache_block *cache_alloc(struct disk_info *disk, uint32_t sector)
+{
+	struct disk_cache_block *block;
+
+	block = SYS_DLIST_PEEK_HEAD_CONTAINER(&cache_lru, block, node);
+
+	if (block->dirty && (cache_flush_run(block) != 0)) {
+		return NULL;
+	}
+
+	block->disk = disk;
+	block->sector = sector;
+	block->dirty = false;
+	cache_touch(block);
+
+	return block;
+}
+
+static int cache_read_miss(struct disk_info *disk, uint8_t *data_buf,
+			   uint32_t start_sector, uint32_t num_sector, bool sequential)
+{
+	struct disk_cache_block *block;
+	uint32_t fetch = num_sector;
+	uint32_t sector_count;
+	int rc;
+
+	if (num_sector >= CACHE_XFER_SECTORS) {
+		/* Large transfers gain nothing from the cache */
+		return disk->ops->read(disk, data_buf, start_sector, num_sector);
+	}
+
+	if (sequential && (disk_cache_sector_count(disk, &sector_count) == 0) &&
+	    (start_sector < sector_count)) {
+		fetch = MAX(num_sector, MIN(CACHE_XFER_SECTORS, sector_count - start_sector));
+	}
+
+	rc = disk->ops->read(disk, cache_fetch_buf, start_sector, fetch);
+	if (rc != 0) {
+		return rc;
+	}
+
+	memcpy(data_buf, cache_fetch_buf, num_sector * CACHE_SECTOR_SIZE);
+
+	for (uint32_t i = 0; i < fetch; i++) {
+		/* Read-ahead sectors may already be cached, possibly dirty */
+		if (cache_find(disk, start_sector + i) != NULL) {
+			continue;
+		}
+
+		block = cache_alloc(disk, start_sector + i);
+		if (block == NULL) {
+			break;
+		}
+
+		memcpy(block->data, &cache_fetch_buf[i * CACHE_SECTOR_SIZE], CACHE_SECTOR_SIZE);
+	}
+
+	return 0;
+}
+
+int disk_cache_read(struct disk_info *disk, uint8_t *data_buf,
+		    uint32_t start_sector, uint32_t num_sector)
+{
+	struct disk_cache_block *block;
+	bool sequential;
+	uint32_t miss;
+	uint32_t i = 0;
+	int rc = 0;
+
+	if (!disk_cache_usable(disk)) {
+		return disk->ops->read(disk, data_buf, start_sector, num_sector);
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	sequential = (stream_disk == disk) && (stream_next_sector == start_sector);
+
+	while (i < num_sector) {
+		block = cache_find(disk, start_sector + i);
+		if (block != NULL) {
+			memcpy(&data_buf[i * CACHE_SECTOR_SIZE], block->data, CACHE_SECTOR_SIZE);
+			cache_touch(block);
+			i++;
+			continue;
+		}
+
+		/* Read the run of missing sectors with a single transfer */
+		miss = 1;
+		while (((i + miss) < num_sector) &&
+		       (cache_find(disk, start_sector + i + miss) == NULL)) {
+			miss++;
+		}
+
+		rc = cache_read_miss(disk, &data_buf[i * CACHE_SECTOR_SIZE],
+				     start_sector + i, miss, sequential);
+		if (rc != 0) {
+			break;
+		}
+
+		i += miss;
+	}
+
+	stream_disk = disk;
+	stream_next_sector = start_sector + num_sector;
+
+	k_mutex_unlock(&cache_lock);
+
+	return rc;
+}
+
+int disk_cache_write(struct disk_info *disk, const uint8_t *data_buf,
+		     uint32_t start_sector, uint32_t num_sector)
+{
+	struct disk_cache_block *block;
+	uint32_t sector_count;
+	int rc = 0;
+
+	if (!disk_cache_usable(disk)) {
+		return disk->ops->write(disk, data_buf, start_sector, num_sector);
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	if (!IS_ENABLED(CONFIG_DISK_ACCESS_CACHE_WRITE_BACK) ||
+	    (num_sector >= CACHE_XFER_SECTORS)) {
+		/* Write through, keeping cached copies up to date */
+		rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+		if (rc != 0) {
+			goto out;
+		}
+
+		for (uint32_t i = 0; i < num_sector; i++) {
+			block = cache_find(disk, start_sector + i);
+			if (block != NULL) {
+				memcpy(block->data, &data_buf[i * CACHE_SECTOR_SIZE],
+				       CACHE_SECTOR_SIZE);
+				block->dirty = false;
+			}
+		}
+
+		goto out;
+	}
+
+	/* Write-back defers the transfer, so range errors have to be caught here */
+	rc = disk_cache_sector_count(disk, &sector_count);
+	if (rc != 0) {
+		goto out;
+	}
+
+	if ((start_sector >= sector_count) || (num_sector > (sector_count - start_sector))) {
+		rc = -EINVAL;
+		goto out;
+	}
+
+	for (uint32_t i = 0; i < num_sector; i++) {
+		block = cache_find(disk, start_sector + i);
+		if (block == NULL) {
+			block = cache_alloc(disk, start_sector + i);
+		} else {
+			cache_touch(block);
+		}
+
+		if (block == NULL) {
+			/* The least recently used block could not be written back */
+			rc = -EIO;
+			break;
+		}
+
+		memcpy(block->data, &data_buf[i * CACHE_SECTOR_SIZE], CACHE_SECTOR_SIZE);
+		block->dirty = true;
+	}
+
+out:
+	k_mutex_unlock(&cache_lock);
+
+	return rc;
+}
+
+int disk_cache_flush(struct disk_info *disk)
+{
+	int rc = 0;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(cache_blocks); i++) {
+		if ((cache_blocks[i].disk == disk) && cache_blocks[i].dirty) {
+			rc = cache_flush_run(&cache_blocks[i]);
+			if (rc != 0) {
+				break;
+			}
+		}
+	}
+
+	k_mutex_unlock(&cache_lock);
+
+	return rc;
+}
+
+void disk_cache_invalidate(struct disk_info *disk, uint32_t start_sector,
+			   uint32_t num_sector)
+{
+	struct disk_cache_block *block;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(cache_blocks); i++) {
+		block = &cache_blocks[i];
+
+		if ((block->disk == disk) && (block->sector >= start_sector) &&
+		    ((block->sector - start_sector) < num_sector)) {
+			cache_drop(block);
+		}
+	}
+
+	if (stream_disk == disk) {
+		stream_disk = NULL;
+	}
+
+	k_mutex_unlock(&cache_lock);
+}
+
+int disk_cache_detach(struct disk_info *disk)
+{
+	int rc;
+
+	rc = disk_cache_flush(disk);
+	if (rc != 0) {
+		/* Keep the dirty sectors, the caller may retry */
+		return rc;
+	}
+
+	disk_cache_invalidate(disk, 0, UINT32_MAX);
+	disk->cache_state = CACHE_STATE_UNKNOWN;
+
+	return 0;
+}
+
+static int disk_cache_init(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(cache_blocks); i++) {
+		sys_dlist_append(&cache_lru, &cache_blocks[i].node);
+	}
+
+	return 0;
+}
+
+SYS_INIT(disk_cache_init, PRE_KERNEL_1, 0);
@@ -0,0 +1,49 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_SUBSYS_DISK_DISK_CACHE_H_
+#define ZEPHYR_SUBSYS_DISK_DISK_CACHE_H_
+
+#include <zephyr/storage/disk_access.h>
+
+/**
+ * @brief Read sectors through the block cache
+ *
+ * Disks whose sector size does not match the cache are read directly.
+ */
+int disk_cache_read(struct disk_info *disk, uint8_t *data_buf,
+		    uint32_t start_sector, uint32_t num_sector);
+
+/**
+ * @brief Write sectors through the block cache
+ *
+ * Disks whose sector size does not match the cache are written directly.
+ */
+int disk_cache_write(struct disk_info *disk, const uint8_t *data_buf,
+		     uint32_t start_sector, uint32_t num_sector);
+
+/**
+ * @brief Write all dirty cached sectors of a disk back to the disk
+ */
+int disk_cache_flush(struct disk_info *disk);
+
+/**
+ * @brief Drop cached sectors of a disk without writing them back
+ */
+void disk_cache_invalidate(struct disk_info *disk, uint32_t start_sector,
+			   uint32_t num_sector);
+
+/**
+ * @brief Write back and drop all cached sectors of a disk
+ *
+ * The sector size of the disk is queried again on next use.
+ *
+ * @return 0 on success, or the write back error, in which case the cache
+ *	   of the disk is left as it was.
+ */
+int disk_cache_detach(struct disk_info *disk);
+
+#endif /* ZEPHYR_SUBSYS_DISK_DISK_CACHE_H_ */
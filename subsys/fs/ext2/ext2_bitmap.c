@@ -72,6 +72,65 @@ int32_t ext2_bitmap_find_free(uint8_t *bm, uint32_t size)
 	return -ENOSPC;
 }
 
+static inline bool bit_is_set(const uint8_t *bm, uint32_t index)
+{
+	return (bm[index / 8] & BIT(index % 8)) != 0;
+}
+
+bool ext2_bitmap_is_set(uint8_t *bm, uint32_t index, uint32_t size)
+{
+	if (index / 8 >= size) {
+		/* bits outside of bitmap are never free */
+		return true;
+	}
+	return bit_is_set(bm, index);
+}
+
+static int32_t find_run(const uint8_t *bm, uint32_t from, uint32_t to, uint32_t len)
+{
+	uint32_t run = 0;
+
+	for (uint32_t i = from; i < to; ++i) {
+		if ((i % 8) == 0 && bm[i / 8] == UINT8_MAX) {
+			/* whole byte used */
+			run = 0;
+			i += 7;
+			continue;
+		}
+
+		if (bit_is_set(bm, i)) {
+			run = 0;
+			continue;
+		}
+
+		if (++run == len) {
+			return i + 1 - len;
+		}
+	}
+	return -ENOSPC;
+}
+
+int32_t ext2_bitmap_find_free_run(uint8_t *bm, uint32_t size, uint32_t start, uint32_t len)
+{
+	uint32_t bits = size * 8;
+	int32_t ret;
+
+	if (len == 0 || len > bits) {
+		return -EINVAL;
+	}
+
+	if (start >= bits) {
+		start = 0;
+	}
+
+	ret = find_run(bm, start, bits, len);
+	if (ret < 0 && start > 0) {
+		/* wrap around, runs may end after start */
+		ret = find_run(bm, 0, MIN(start + len - 1, bits), len);
+	}
+	return ret;
+}
+
 uint32_t ext2_bitmap_count_set(uint8_t *bm, uint32_t size)
 {
 	int32_t count = 0;
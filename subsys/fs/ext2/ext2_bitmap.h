@@ -40,6 +40,18 @@ int ext2_bitmap_set(uint8_t *bm, uint32_t index, uint32_t size);
  */
 int ext2_bitmap_unset(uint8_t *bm, uint32_t index, uint32_t size);
 
+/**
+ * @brief Check if bit at given index is set
+ *
+ * @param bm Pointer to bitmap
+ * @param index Index in bitmap
+ * @param size Size of bitmap in bytes
+ *
+ * @retval true when bit is set or index is outside of bitmap;
+ * @retval false when bit is zero;
+ */
+bool ext2_bitmap_is_set(uint8_t *bm, uint32_t index, uint32_t size);
+
 /**
  * @brief Find first bit set to zero in bitmap
  *
@@ -51,6 +63,22 @@ int ext2_bitmap_unset(uint8_t *bm, uint32_t index, uint32_t size);
  */
 int32_t ext2_bitmap_find_free(uint8_t *bm, uint32_t size);
 
+/**
+ * @brief Find a run of bits set to zero in bitmap
+ *
+ * The search starts at given index and wraps around to the beginning of the bitmap.
+ *
+ * @param bm Pointer to bitmap
+ * @param size Size of bitmap in bytes
+ * @param start Index where the search starts
+ * @param len Number of consecutive zero bits to find
+ *
+ * @retval >=0 index of the first bit of the run;
+ * @retval -ENOSPC when not found;
+ * @retval -EINVAL when len is invalid;
+ */
+int32_t ext2_bitmap_find_free_run(uint8_t *bm, uint32_t size, uint32_t start, uint32_t len);
+
 /**
  * @brief Helper function to count bits set in bitmap
  *
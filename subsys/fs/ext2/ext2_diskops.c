@@ -244,6 +244,13 @@ int ext2_fetch_block_group(struct ext2_data *fs, uint32_t group)
 		return 0;
 	}
 
+	/* Changes to the cached group must reach the disk before it is replaced */
+	int rc = ext2_sync_metadata(fs);
+
+	if (rc < 0) {
+		return rc;
+	}
+
 	uint32_t ngroups = get_ngroups(fs);
 
 	LOG_DBG("ngroups:%d", ngroups);
@@ -299,6 +306,15 @@ int ext2_fetch_bg_itable(struct ext2_bgroup *bg, uint32_t block)
 	struct ext2_data *fs = bg->fs;
 	uint32_t global_block = bg->bg_inode_table + block;
 
+	if (bg->dirty & EXT2_BG_DIRTY_ITABLE) {
+		int rc = ext2_write_block(fs, bg->inode_table);
+
+		if (rc < 0) {
+			return rc;
+		}
+		bg->dirty &= ~EXT2_BG_DIRTY_ITABLE;
+	}
+
 	ext2_drop_block(bg->inode_table);
 	bg->inode_table = ext2_get_block(fs, global_block);
 	if (bg->inode_table == NULL) {
@@ -729,7 +745,7 @@ static int alloc_level_blocks(struct ext2_inode *inode)
 		}
 
 		if (*block == 0) {
-			ret = ext2_assign_block_num(fs, inode->blocks[lvl]);
+			ret = ext2_assign_block_num(fs, inode, inode->blocks[lvl]);
 			if (ret < 0) {
 				return ret;
 			}
@@ -818,6 +834,92 @@ int ext2_commit_bg(struct ext2_data *fs)
 	return 0;
 }
 
+int ext2_sync_metadata(struct ext2_data *fs)
+{
+	int rc;
+	struct ext2_bgroup *bg = &fs->bgroup;
+
+	if (bg->dirty & EXT2_BG_DIRTY_ITABLE) {
+		rc = ext2_write_block(fs, bg->inode_table);
+		if (rc < 0) {
+			return rc;
+		}
+		bg->dirty &= ~EXT2_BG_DIRTY_ITABLE;
+	}
+	if (bg->dirty & EXT2_BG_DIRTY_IBITMAP) {
+		rc = ext2_write_block(fs, bg->inode_bitmap);
+		if (rc < 0) {
+			return rc;
+		}
+		bg->dirty &= ~EXT2_BG_DIRTY_IBITMAP;
+	}
+	if (bg->dirty & EXT2_BG_DIRTY_BBITMAP) {
+		rc = ext2_write_block(fs, bg->block_bitmap);
+		if (rc < 0) {
+			return rc;
+		}
+		bg->dirty &= ~EXT2_BG_DIRTY_BBITMAP;
+	}
+	if (bg->dirty & EXT2_BG_DIRTY_DESC) {
+		rc = ext2_commit_bg(fs);
+		if (rc < 0) {
+			return rc;
+		}
+		bg->dirty &= ~EXT2_BG_DIRTY_DESC;
+	}
+	if (fs->flags & EXT2_DATA_FLAGS_SB_DIRTY) {
+		rc = ext2_commit_superblock(fs);
+		if (rc < 0) {
+			return rc;
+		}
+		fs->flags &= ~EXT2_DATA_FLAGS_SB_DIRTY;
+	}
+	return 0;
+}
+
+/* Write the fetched inode table block, or only mark it dirty with the write-back cache. */
+static int write_itable(struct ext2_data *fs)
+{
+	if (IS_ENABLED(CONFIG_EXT2_WRITEBACK_CACHE)) {
+		fs->bgroup.dirty |= EXT2_BG_DIRTY_ITABLE;
+		return 0;
+	}
+	return ext2_write_block(fs, fs->bgroup.inode_table);
+}
+
+/* Write superblock, block group and bitmap (EXT2_BG_DIRTY_IBITMAP or EXT2_BG_DIRTY_BBITMAP)
+ * changed when an inode or block was reserved or freed.
+ */
+static int commit_alloc(struct ext2_data *fs, uint8_t bitmap)
+{
+	int rc;
+	struct ext2_block *b = (bitmap == EXT2_BG_DIRTY_IBITMAP) ?
+		fs->bgroup.inode_bitmap : fs->bgroup.block_bitmap;
+
+	if (IS_ENABLED(CONFIG_EXT2_WRITEBACK_CACHE)) {
+		fs->flags |= EXT2_DATA_FLAGS_SB_DIRTY;
+		fs->bgroup.dirty |= EXT2_BG_DIRTY_DESC | bitmap;
+		return 0;
+	}
+
+	rc = ext2_commit_superblock(fs);
+	if (rc < 0) {
+		LOG_DBG("super block write returned: %d", rc);
+		return -EIO;
+	}
+	rc = ext2_commit_bg(fs);
+	if (rc < 0) {
+		LOG_DBG("block group write returned: %d", rc);
+		return -EIO;
+	}
+	rc = ext2_write_block(fs, b);
+	if (rc < 0) {
+		LOG_DBG("bitmap write returned: %d", rc);
+		return -EIO;
+	}
+	return 0;
+}
+
 int ext2_commit_inode(struct ext2_inode *inode)
 {
 	struct ext2_data *fs = inode->i_fs;
@@ -834,7 +936,7 @@ int ext2_commit_inode(struct ext2_inode *inode)
 	/* fill dinode */
 	fill_disk_inode(dino, inode);
 
-	return ext2_write_block(fs, fs->bgroup.inode_table);
+	return write_itable(fs);
 }
 
 int ext2_commit_inode_block(struct ext2_inode *inode)
@@ -865,11 +967,79 @@ int ext2_clear_inode(struct ext2_data *fs, uint32_t ino)
 	}
 
 	memset(&BGROUP_INODE_TABLE(&fs->bgroup)[itable_offset], 0, sizeof(struct ext2_disk_inode));
-	ret = ext2_write_block(fs, fs->bgroup.inode_table);
+	ret = write_itable(fs);
 	return ret;
 }
 
-int64_t ext2_alloc_block(struct ext2_data *fs)
+#if CONFIG_EXT2_PREALLOC_BLOCKS > 0
+/* Check if blocks [block, block + len) overlap a run reserved for another inode. */
+static bool rsv_overlaps(struct ext2_data *fs, struct ext2_inode *inode, uint32_t block,
+			 uint32_t len, uint32_t *end)
+{
+	for (int32_t i = 0; i < fs->open_inodes; ++i) {
+		struct ext2_inode *other = fs->inode_pool[i];
+
+		if (other == inode || other->rsv_next >= other->rsv_end) {
+			continue;
+		}
+		if (block < other->rsv_end && other->rsv_next < block + len) {
+			*end = other->rsv_end;
+			return true;
+		}
+	}
+	return false;
+}
+
+/* Take the next block of the run reserved for the inode, or reserve a new run of free blocks
+ * in the fetched block group. Reservations live only in memory, nothing is marked in the bitmap
+ * until a block is really allocated.
+ */
+static int32_t find_reserved_slot(struct ext2_data *fs, struct ext2_inode *inode)
+{
+	uint8_t *bm = BGROUP_BLOCK_BITMAP(&fs->bgroup);
+	uint32_t first = fs->bgroup.num * fs->sblock.s_blocks_per_group +
+			 fs->sblock.s_first_data_block;
+	uint32_t goal = 0, end;
+	int32_t slot = -ENOSPC;
+
+	if (inode->rsv_next < inode->rsv_end && inode->rsv_next >= first) {
+		slot = inode->rsv_next - first;
+		if (!ext2_bitmap_is_set(bm, slot, fs->block_size)) {
+			inode->rsv_next++;
+			return slot;
+		}
+	}
+
+	/* Continue right after the previous run if possible. */
+	if (inode->rsv_end > first) {
+		goal = inode->rsv_end - first;
+	}
+
+	for (int i = 0; i <= MAX_INODES; ++i) {
+		slot = ext2_bitmap_find_free_run(bm, fs->block_size, goal,
+						 CONFIG_EXT2_PREALLOC_BLOCKS);
+		if (slot < 0 ||
+		    !rsv_overlaps(fs, inode, first + slot, CONFIG_EXT2_PREALLOC_BLOCKS, &end)) {
+			break;
+		}
+		goal = end - first;
+		slot = -ENOSPC;
+	}
+
+	if (slot < 0) {
+		inode->rsv_next = inode->rsv_end = 0;
+		return slot;
+	}
+
+	LOG_DBG("inode:%d reserved blocks %d-%d", inode->i_id, first + slot,
+		first + slot + CONFIG_EXT2_PREALLOC_BLOCKS - 1);
+	inode->rsv_next = first + slot + 1;
+	inode->rsv_end = first + slot + CONFIG_EXT2_PREALLOC_BLOCKS;
+	return slot;
+}
+#endif /* CONFIG_EXT2_PREALLOC_BLOCKS > 0 */
+
+int64_t ext2_alloc_block(struct ext2_data *fs, struct ext2_inode *inode)
 {
 	int rc, bitmap_slot;
 	uint32_t group = 0, set;
@@ -898,7 +1068,17 @@ int64_t ext2_alloc_block(struct ext2_data *fs)
 		return rc;
 	}
 
-	bitmap_slot = ext2_bitmap_find_free(BGROUP_BLOCK_BITMAP(&fs->bgroup), fs->block_size);
+	bitmap_slot = -ENOSPC;
+#if CONFIG_EXT2_PREALLOC_BLOCKS > 0
+	if (inode != NULL) {
+		bitmap_slot = find_reserved_slot(fs, inode);
+	}
+#endif
+	if (bitmap_slot < 0) {
+		/* Reserved runs are only a hint, any free block will do. */
+		bitmap_slot = ext2_bitmap_find_free(BGROUP_BLOCK_BITMAP(&fs->bgroup),
+						    fs->block_size);
+	}
 	if (bitmap_slot < 0) {
 		LOG_WRN("Cannot find free block in group %d (rc: %d)", group, bitmap_slot);
 		return bitmap_slot;
@@ -924,20 +1104,9 @@ int64_t ext2_alloc_block(struct ext2_data *fs)
 		return -EINVAL;
 	}
 
-	rc = ext2_commit_superblock(fs);
-	if (rc < 0) {
-		LOG_DBG("super block write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_commit_bg(fs);
+	rc = commit_alloc(fs, EXT2_BG_DIRTY_BBITMAP);
 	if (rc < 0) {
-		LOG_DBG("block group write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_write_block(fs, fs->bgroup.block_bitmap);
-	if (rc < 0) {
-		LOG_DBG("block bitmap write returned: %d", rc);
-		return -EIO;
+		return rc;
 	}
 	return total;
 }
@@ -1021,20 +1190,9 @@ int32_t ext2_alloc_inode(struct ext2_data *fs)
 		return -EINVAL;
 	}
 
-	rc = ext2_commit_superblock(fs);
+	rc = commit_alloc(fs, EXT2_BG_DIRTY_IBITMAP);
 	if (rc < 0) {
-		LOG_DBG("super block write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_commit_bg(fs);
-	if (rc < 0) {
-		LOG_DBG("block group write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_write_block(fs, fs->bgroup.inode_bitmap);
-	if (rc < 0) {
-		LOG_DBG("block bitmap write returned: %d", rc);
-		return -EIO;
+		return rc;
 	}
 
 	LOG_DBG("Free inodes (bg): %d", fs->bgroup.bg_free_inodes_count);
@@ -1080,20 +1238,9 @@ int ext2_free_block(struct ext2_data *fs, uint32_t block)
 		return -EINVAL;
 	}
 
-	rc = ext2_commit_superblock(fs);
-	if (rc < 0) {
-		LOG_DBG("super block write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_commit_bg(fs);
+	rc = commit_alloc(fs, EXT2_BG_DIRTY_BBITMAP);
 	if (rc < 0) {
-		LOG_DBG("block group write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_write_block(fs, fs->bgroup.block_bitmap);
-	if (rc < 0) {
-		LOG_DBG("block bitmap write returned: %d", rc);
-		return -EIO;
+		return rc;
 	}
 	return 0;
 }
@@ -1143,19 +1290,12 @@ int ext2_free_inode(struct ext2_data *fs, uint32_t ino, bool directory)
 
 	LOG_INF("Inode %d is free", ino);
 
-	rc = ext2_commit_superblock(fs);
+	rc = commit_alloc(fs, EXT2_BG_DIRTY_IBITMAP);
 	if (rc < 0) {
-		LOG_DBG("super block write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_commit_bg(fs);
-	if (rc < 0) {
-		LOG_DBG("block group write returned: %d", rc);
-		return -EIO;
+		return rc;
 	}
-	rc = ext2_write_block(fs, fs->bgroup.inode_bitmap);
+	rc = ext2_sync_metadata(fs);
 	if (rc < 0) {
-		LOG_DBG("block bitmap write returned: %d", rc);
 		return -EIO;
 	}
 	rc = fs->backend_ops->sync(fs);
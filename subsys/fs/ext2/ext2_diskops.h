@@ -132,6 +132,20 @@ int ext2_commit_inode(struct ext2_inode *inode);
  */
 int ext2_commit_inode_block(struct ext2_inode *inode);
 
+/**
+ * @brief Write metadata kept only in memory to the disk.
+ *
+ * With @kconfig{CONFIG_EXT2_WRITEBACK_CACHE} the superblock, block group descriptor,
+ * bitmaps and inode table block changed by allocations are not written immediately.
+ * This function writes all of them. Without the write-back cache it has no effect.
+ *
+ * @param fs File system data struct
+ *
+ * @retval 0 on success
+ * @retval <0 error
+ */
+int ext2_sync_metadata(struct ext2_data *fs);
+
 /**
  * @brief Commit changes made to superblock structure.
  *
@@ -169,12 +183,17 @@ int ext2_commit_bg(struct ext2_data *fs);
  * Search for a free block. If block is found, proper fields in superblock and
  * block group are updated and block is marked as used in block bitmap.
  *
+ * When @kconfig{CONFIG_EXT2_PREALLOC_BLOCKS} is not zero and the inode is given,
+ * the block is taken from a run of free blocks reserved for that inode, so that
+ * growing files stay contiguous.
+ *
  * @param fs File system data
+ * @param inode Inode that will use the block (may be NULL)
  *
  * @retval >0 number of allocated block
  * @retval <0 error
  */
-int64_t ext2_alloc_block(struct ext2_data *fs);
+int64_t ext2_alloc_block(struct ext2_data *fs, struct ext2_inode *inode);
 
 /**
  * @brief Reserve an inode for future use.
@@ -159,7 +159,7 @@ void ext2_init_blocks_slab(struct ext2_data *fs)
 			CONFIG_EXT2_MAX_BLOCK_COUNT);
 }
 
-int ext2_assign_block_num(struct ext2_data *fs, struct ext2_block *b)
+int ext2_assign_block_num(struct ext2_data *fs, struct ext2_inode *inode, struct ext2_block *b)
 {
 	int64_t new_block;
 
@@ -168,7 +168,7 @@ int ext2_assign_block_num(struct ext2_data *fs, struct ext2_block *b)
 	}
 
 	/* Allocate block in the file system. */
-	new_block = ext2_alloc_block(fs);
+	new_block = ext2_alloc_block(fs, inode);
 	if (new_block < 0) {
 		return new_block;
 	}
@@ -370,6 +370,11 @@ int ext2_close_fs(struct ext2_data *fs)
 		}
 	}
 
+	ret = ext2_sync_metadata(fs);
+	if (ret < 0) {
+		return ret;
+	}
+
 	/* To save file system as correct it must be writable and without errors */
 	if (!(fs->flags & (EXT2_DATA_FLAGS_RO | EXT2_DATA_FLAGS_ERR))) {
 		fs->sblock.s_state = EXT2_VALID_FS;
@@ -645,6 +650,7 @@ ssize_t ext2_inode_write(struct ext2_inode *inode, const void *buf, uint32_t off
 	int rc = 0;
 	ssize_t written = 0;
 	uint32_t block_size = inode->i_fs->block_size;
+	uint32_t end = offset + nbytes;
 
 	while (written < nbytes) {
 		uint32_t block = offset / block_size;
@@ -658,7 +664,7 @@ ssize_t ext2_inode_write(struct ext2_inode *inode, const void *buf, uint32_t off
 			break;
 		}
 
-		size_t to_write = MIN(nbytes, block_size - block_off);
+		size_t to_write = MIN(nbytes - written, block_size - block_off);
 
 		memcpy(inode_current_block_mem(inode) + block_off, (uint8_t *)buf + written,
 				to_write);
@@ -670,15 +676,16 @@ ssize_t ext2_inode_write(struct ext2_inode *inode, const void *buf, uint32_t off
 		}
 
 		written += to_write;
+		offset += to_write;
 	}
 
 	if (rc < 0) {
 		return rc;
 	}
 
-	if (offset + written > inode->i_size) {
-		LOG_DBG("New inode size: %d -> %zd", inode->i_size, offset + written);
-		inode->i_size = offset + written;
+	if (end > inode->i_size) {
+		LOG_DBG("New inode size: %d -> %d", inode->i_size, end);
+		inode->i_size = end;
 		rc = ext2_commit_inode(inode);
 		if (rc < 0) {
 			return rc;
@@ -743,6 +750,9 @@ int ext2_inode_trunc(struct ext2_inode *inode, off_t length)
 
 		LOG_DBG("Inode trunc from blk: %d", start_blk);
 
+		/* Blocks reserved for growing the file are likely not next to its end anymore */
+		inode->rsv_next = inode->rsv_end = 0;
+
 		/* Remove blocks starting with start_blk. */
 		removed_blocks = ext2_inode_remove_blocks(inode, start_blk);
 		if (removed_blocks < 0) {
@@ -762,12 +772,13 @@ int ext2_inode_trunc(struct ext2_inode *inode, off_t length)
 	return rc;
 }
 
-static int write_one_block(struct ext2_data *fs, struct ext2_block *b)
+static int write_one_block(struct ext2_inode *inode, struct ext2_block *b)
 {
 	int ret = 0;
+	struct ext2_data *fs = inode->i_fs;
 
 	if (!(b->flags & EXT2_BLOCK_ASSIGNED)) {
-		ret = ext2_assign_block_num(fs, b);
+		ret = ext2_assign_block_num(fs, inode, b);
 		if (ret < 0) {
 			return ret;
 		}
@@ -786,7 +797,7 @@ int ext2_inode_sync(struct ext2_inode *inode)
 		if (inode->blocks[i] == NULL) {
 			break;
 		}
-		ret = write_one_block(fs, inode->blocks[i]);
+		ret = write_one_block(inode, inode->blocks[i]);
 		if (ret < 0) {
 			return ret;
 		}
@@ -795,6 +806,14 @@ int ext2_inode_sync(struct ext2_inode *inode)
 			return ret;
 		}
 	}
+
+	if (IS_ENABLED(CONFIG_EXT2_WRITEBACK_CACHE)) {
+		ret = ext2_sync_metadata(fs);
+		if (ret < 0) {
+			return ret;
+		}
+		return fs->backend_ops->sync(fs);
+	}
 	return 0;
 }
 
@@ -53,7 +53,7 @@ void ext2_init_blocks_slab(struct ext2_data *fs);
  */
 int ext2_write_block(struct ext2_data *fs, struct ext2_block *b);
 
-int ext2_assign_block_num(struct ext2_data *fs, struct ext2_block *b);
+int ext2_assign_block_num(struct ext2_data *fs, struct ext2_inode *inode, struct ext2_block *b);
 
 /* FS operations */
 
@@ -216,6 +216,8 @@ int ext2_inode_trunc(struct ext2_inode *inode, off_t size);
 /**
  * @brief Sync currently fetched blocks
  *
+ * Metadata kept in the write-back cache is written too.
+ *
  * @param inode Inode
  *
  */
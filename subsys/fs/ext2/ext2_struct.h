@@ -142,6 +142,12 @@ struct ext2_block {
 #define BGROUP_INODE_BITMAP(bg) ((uint8_t *)(bg)->inode_bitmap->data)
 #define BGROUP_BLOCK_BITMAP(bg) ((uint8_t *)(bg)->block_bitmap->data)
 
+/* Flags for block group parts modified only in memory (write-back cache) */
+#define EXT2_BG_DIRTY_DESC    BIT(0)
+#define EXT2_BG_DIRTY_IBITMAP BIT(1)
+#define EXT2_BG_DIRTY_BBITMAP BIT(2)
+#define EXT2_BG_DIRTY_ITABLE  BIT(3)
+
 struct ext2_bgroup {
 	struct ext2_data *fs;       /* pointer to file system data */
 
@@ -151,6 +157,7 @@ struct ext2_bgroup {
 
 	int32_t num;                /* number of described block group */
 	uint32_t inode_table_block; /* number of fetched block (relative) */
+	uint8_t dirty;              /* parts not yet written to disk */
 
 	uint32_t bg_block_bitmap;
 	uint32_t bg_inode_bitmap;
@@ -180,6 +187,9 @@ struct ext2_inode {
 	uint32_t block_num;        /* relative number of fetched block */
 	uint32_t offsets[4];       /* offsets describing path to fetched block */
 	struct ext2_block *blocks[4];   /* fetched blocks for each level */
+
+	uint32_t rsv_next;         /* next block of reserved run */
+	uint32_t rsv_end;          /* end of reserved run (0 if none) */
 };
 
 static inline struct ext2_block *inode_current_block(struct ext2_inode *inode)
@@ -212,6 +222,7 @@ struct ext2_file {
 
 #define EXT2_DATA_FLAGS_RO  BIT(0)
 #define EXT2_DATA_FLAGS_ERR BIT(1)
+#define EXT2_DATA_FLAGS_SB_DIRTY BIT(2)
 
 struct ext2_data;
 
@@ -168,6 +168,12 @@ int fcb_init(int f_area_id, struct fcb *fcbp)
 		}
 	}
 	k_mutex_init(&fcbp->f_mtx);
+
+#ifdef CONFIG_FCB_INDEX
+	if (rc == 0 && fcbp->f_index != NULL) {
+		rc = fcb_index_build(fcbp);
+	}
+#endif
 	return rc;
 }
 
@@ -266,6 +272,10 @@ int fcb_sector_hdr_init(struct fcb *fcbp, struct flash_sector *sector, uint16_t
 	if (rc != 0) {
 		return -EIO;
 	}
+
+#ifdef CONFIG_FCB_INDEX
+	fcb_index_sector_reset(fcbp, sector, id);
+#endif
 	return 0;
 }
 
@@ -314,6 +324,12 @@ int fcb_offset_last_n(struct fcb *fcbp, uint8_t entries, struct fcb_entry *last_
 		entries = 1U;
 	}
 
+#ifdef CONFIG_FCB_INDEX
+	if (fcbp->f_index != NULL) {
+		return fcb_index_last_n(fcbp, entries, last_n_entry);
+	}
+#endif
+
 	i = 0;
 	(void)memset(&loc, 0, sizeof(loc));
 	while (!fcb_getnext(fcbp, &loc)) {
@@ -0,0 +1,278 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/fs/fcb.h>
+#include "fcb_priv.h"
+
+#define FCB_INDEX_CAP CONFIG_FCB_INDEX_SECTOR_ENTRIES
+
+#define FCB_SEQ(id, pos) (((uint32_t)(id) << 16) | (uint32_t)(pos))
+#define FCB_SEQ_ID(seq)  ((uint16_t)((seq) >> 16))
+#define FCB_SEQ_POS(seq) ((seq) & 0xffffU)
+
+static struct fcb_sector_index *
+fcb_index_get(struct fcb *fcbp, const struct flash_sector *sector)
+{
+	return &fcbp->f_index[sector - fcbp->f_sectors];
+}
+
+static struct flash_sector *
+fcb_index_prev_sector(struct fcb *fcbp, struct flash_sector *sector)
+{
+	if (sector == &fcbp->f_sectors[0]) {
+		return &fcbp->f_sectors[fcbp->f_sector_cnt - 1];
+	}
+	return sector - 1;
+}
+
+/*
+ * Fill in loc with the entry at position pos of the sector. Positions past the
+ * indexed entries are reached by walking from the last indexed one.
+ */
+static int
+fcb_index_entry(struct fcb *fcbp, struct flash_sector *sector, uint32_t pos,
+		struct fcb_entry *loc)
+{
+	struct fcb_sector_index *idx = fcb_index_get(fcbp, sector);
+	uint32_t i;
+	int rc;
+
+	if (pos >= idx->fi_count) {
+		return -ENOENT;
+	}
+
+	i = MIN(pos, FCB_INDEX_CAP - 1);
+	loc->fe_sector = sector;
+	loc->fe_elem_off = idx->fi_off[i];
+	rc = fcb_elem_info(fcbp, loc);
+
+	for (; rc == 0 && i < pos; i++) {
+		rc = fcb_getnext_in_sector(fcbp, loc);
+	}
+
+	return (rc == -ENOTSUP) ? -ENOENT : rc;
+}
+
+void
+fcb_index_sector_reset(struct fcb *fcbp, const struct flash_sector *sector, uint16_t id)
+{
+	struct fcb_sector_index *idx;
+
+	if (fcbp->f_index == NULL) {
+		return;
+	}
+
+	idx = fcb_index_get(fcbp, sector);
+	idx->fi_id = id;
+	idx->fi_count = 0U;
+}
+
+void
+fcb_index_add(struct fcb *fcbp, const struct fcb_entry *loc)
+{
+	struct fcb_sector_index *idx;
+	uint32_t n;
+	uint32_t i;
+
+	if (fcbp->f_index == NULL) {
+		return;
+	}
+
+	idx = fcb_index_get(fcbp, loc->fe_sector);
+	n = MIN(idx->fi_count, FCB_INDEX_CAP);
+
+	/* Entries are normally finished in the order they were appended */
+	for (i = n; i > 0 && idx->fi_off[i - 1] >= loc->fe_elem_off; i--) {
+		if (idx->fi_off[i - 1] == loc->fe_elem_off) {
+			return;
+		}
+	}
+
+	idx->fi_count++;
+	if (i == FCB_INDEX_CAP) {
+		return;
+	}
+
+	if (n == FCB_INDEX_CAP) {
+		n--;
+	}
+	memmove(&idx->fi_off[i + 1], &idx->fi_off[i], (n - i) * sizeof(idx->fi_off[0]));
+	idx->fi_off[i] = loc->fe_elem_off;
+}
+
+int
+fcb_index_build(struct fcb *fcbp)
+{
+	struct flash_sector *sector;
+	struct fcb_disk_area fda;
+	struct fcb_entry loc;
+	int rc;
+
+	for (int i = 0; i < fcbp->f_sector_cnt; i++) {
+		fcb_index_sector_reset(fcbp, &fcbp->f_sectors[i], 0U);
+	}
+
+	sector = fcbp->f_oldest;
+	while (true) {
+		rc = fcb_sector_hdr_read(fcbp, sector, &fda);
+		if (rc < 0) {
+			return rc;
+		}
+		fcb_index_get(fcbp, sector)->fi_id = fda.fd_id;
+
+		if (sector == fcbp->f_active.fe_sector) {
+			break;
+		}
+		sector = fcb_getnext_sector(fcbp, sector);
+	}
+
+	(void)memset(&loc, 0, sizeof(loc));
+	while ((rc = fcb_getnext_nolock(fcbp, &loc)) == 0) {
+		fcb_index_add(fcbp, &loc);
+	}
+
+	return (rc == -ENOTSUP) ? 0 : rc;
+}
+
+int
+fcb_index_last_n(struct fcb *fcbp, uint32_t entries, struct fcb_entry *last_n_entry)
+{
+	struct flash_sector *sector;
+	struct flash_sector *oldest = NULL;
+	struct fcb_sector_index *idx;
+	int rc;
+
+	rc = k_mutex_lock(&fcbp->f_mtx, K_FOREVER);
+	if (rc) {
+		return -EINVAL;
+	}
+
+	/* Count back from the newest entry, sector by sector */
+	sector = fcbp->f_active.fe_sector;
+	while (true) {
+		idx = fcb_index_get(fcbp, sector);
+		if (idx->fi_count >= entries) {
+			rc = fcb_index_entry(fcbp, sector, idx->fi_count - entries, last_n_entry);
+			goto out;
+		}
+		if (idx->fi_count > 0U) {
+			entries -= idx->fi_count;
+			oldest = sector;
+		}
+
+		if (sector == fcbp->f_oldest) {
+			break;
+		}
+		sector = fcb_index_prev_sector(fcbp, sector);
+	}
+
+	/* Fewer entries than asked for, start from the oldest one */
+	if (oldest == NULL) {
+		rc = -ENOENT;
+	} else {
+		rc = fcb_index_entry(fcbp, oldest, 0U, last_n_entry);
+	}
+out:
+	k_mutex_unlock(&fcbp->f_mtx);
+	return rc;
+}
+
+int
+fcb_entry_seq(struct fcb *fcbp, const struct fcb_entry *loc, uint32_t *seq)
+{
+	struct fcb_sector_index *idx;
+	struct fcb_entry walk;
+	uint32_t pos;
+	int rc;
+
+	if (fcbp->f_index == NULL) {
+		return -ENOTSUP;
+	}
+
+	if (loc->fe_sector < fcbp->f_sectors ||
+	    loc->fe_sector >= &fcbp->f_sectors[fcbp->f_sector_cnt]) {
+		return -ENOENT;
+	}
+
+	rc = k_mutex_lock(&fcbp->f_mtx, K_FOREVER);
+	if (rc) {
+		return -EINVAL;
+	}
+
+	idx = fcb_index_get(fcbp, loc->fe_sector);
+	rc = -ENOENT;
+
+	for (pos = 0U; pos < MIN(idx->fi_count, FCB_INDEX_CAP); pos++) {
+		if (idx->fi_off[pos] == loc->fe_elem_off) {
+			rc = 0;
+			break;
+		}
+	}
+
+	if (rc != 0 && idx->fi_count > FCB_INDEX_CAP &&
+	    loc->fe_elem_off > idx->fi_off[FCB_INDEX_CAP - 1]) {
+		/* Not indexed, count the entries after the last indexed one */
+		pos = FCB_INDEX_CAP - 1;
+		walk.fe_sector = loc->fe_sector;
+		walk.fe_elem_off = idx->fi_off[pos];
+
+		while (pos < idx->fi_count - 1 && walk.fe_elem_off < loc->fe_elem_off) {
+			rc = fcb_getnext_in_sector(fcbp, &walk);
+			if (rc) {
+				break;
+			}
+			pos++;
+		}
+		rc = (walk.fe_elem_off == loc->fe_elem_off) ? 0 : -ENOENT;
+	}
+
+	if (rc == 0) {
+		if (pos > 0xffffU) {
+			rc = -ERANGE;
+		} else {
+			*seq = FCB_SEQ(idx->fi_id, pos);
+		}
+	}
+
+	k_mutex_unlock(&fcbp->f_mtx);
+	return rc;
+}
+
+int
+fcb_seek(struct fcb *fcbp, uint32_t seq, struct fcb_entry *loc)
+{
+	struct flash_sector *sector;
+	int rc;
+
+	if (fcbp->f_index == NULL) {
+		return -ENOTSUP;
+	}
+
+	rc = k_mutex_lock(&fcbp->f_mtx, K_FOREVER);
+	if (rc) {
+		return -EINVAL;
+	}
+
+	rc = -ENOENT;
+	sector = fcbp->f_oldest;
+	while (true) {
+		if (fcb_index_get(fcbp, sector)->fi_id == FCB_SEQ_ID(seq)) {
+			rc = fcb_index_entry(fcbp, sector, FCB_SEQ_POS(seq), loc);
+			break;
+		}
+
+		if (sector == fcbp->f_active.fe_sector) {
+			break;
+		}
+		sector = fcb_getnext_sector(fcbp, sector);
+	}
+
+	k_mutex_unlock(&fcbp->f_mtx);
+	return rc;
+}
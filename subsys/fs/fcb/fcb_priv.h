@@ -78,6 +78,13 @@ int fcb_elem_endmarker(struct fcb *fcbp, struct fcb_entry *loc, uint8_t *crc8p);
 int fcb_sector_hdr_init(struct fcb *fcbp, struct flash_sector *sector, uint16_t id);
 int fcb_sector_hdr_read(struct fcb *fcbp, struct flash_sector *sector, struct fcb_disk_area *fdap);
 
+#ifdef CONFIG_FCB_INDEX
+int fcb_index_build(struct fcb *fcbp);
+void fcb_index_sector_reset(struct fcb *fcbp, const struct flash_sector *sector, uint16_t id);
+void fcb_index_add(struct fcb *fcbp, const struct fcb_entry *loc);
+int fcb_index_last_n(struct fcb *fcbp, uint32_t entries, struct fcb_entry *last_n_entry);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -24,6 +24,9 @@ fcb_rotate(struct fcb *fcb)
 		rc = -EIO;
 		goto out;
 	}
+#ifdef CONFIG_FCB_INDEX
+	fcb_index_sector_reset(fcb, fcb->f_oldest, 0U);
+#endif
 	if (fcb->f_oldest == fcb->f_active.fe_sector) {
 		/*
 		 * Need to create a new active area, as we're wiping
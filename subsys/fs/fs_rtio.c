@@ -0,0 +1,167 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/fs/fs_rtio.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/sys/mpsc_lockfree.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(fs, CONFIG_FS_LOG_LEVEL);
+
+/*
+ * Requests are executed by a small pool of worker threads. All requests
+ * for files of one mount point go to the same worker, so that they run in
+ * submission order, while a slow operation on one mount point (e.g. a
+ * flash erase) does not hold up the others when more than one worker is
+ * configured.
+ */
+struct fs_rtio_worker {
+	struct k_thread thread;
+	struct mpsc queue;
+	struct k_spinlock lock;
+	struct k_sem pending;
+};
+
+static K_THREAD_STACK_ARRAY_DEFINE(fs_rtio_stacks, CONFIG_FILE_SYSTEM_RTIO_WORKERS,
+				   CONFIG_FILE_SYSTEM_RTIO_STACK_SIZE);
+static struct fs_rtio_worker fs_rtio_workers[CONFIG_FILE_SYSTEM_RTIO_WORKERS];
+
+static struct fs_rtio_worker *fs_rtio_worker_get(const struct fs_mount_t *mp)
+{
+	return &fs_rtio_workers[((uintptr_t)mp / sizeof(*mp)) % ARRAY_SIZE(fs_rtio_workers)];
+}
+
+static void fs_rtio_execute(struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct rtio_sqe *sqe = &iodev_sqe->sqe;
+	struct fs_rtio_file *data = sqe->iodev->data;
+	uint32_t buf_len;
+	uint8_t *buf;
+	ssize_t rc = 0;
+	int err;
+
+	if (data->lock != NULL) {
+		k_mutex_lock(data->lock, K_FOREVER);
+	}
+
+	if ((sqe->op != RTIO_OP_NOP) && (data->offset != FS_RTIO_OFFSET_CURRENT)) {
+		rc = fs_seek(data->file, data->offset, FS_SEEK_SET);
+	}
+
+	if (rc == 0) {
+		switch (sqe->op) {
+		case RTIO_OP_RX:
+			/* Reads into the context's memory pool get a single block */
+			rc = rtio_sqe_rx_buf(iodev_sqe, 0,
+					     rtio_mempool_block_size(iodev_sqe->r), &buf, &buf_len);
+			if (rc == 0) {
+				rc = fs_read(data->file, buf, buf_len);
+			}
+			break;
+		case RTIO_OP_TX:
+			rc = fs_write(data->file, sqe->tx.buf, sqe->tx.buf_len);
+			break;
+		case RTIO_OP_NOP:
+			break;
+		default:
+			rc = -ENOTSUP;
+			break;
+		}
+	}
+
+	if ((rc >= 0) && ((sqe->iodev_flags & FS_RTIO_SYNC) != 0)) {
+		err = fs_sync(data->file);
+		if (err < 0) {
+			rc = err;
+		}
+	}
+
+	if ((rc > 0) && (data->offset != FS_RTIO_OFFSET_CURRENT)) {
+		data->offset += rc;
+	}
+
+	if (data->lock != NULL) {
+		k_mutex_unlock(data->lock);
+	}
+
+	if (rc < 0) {
+		rtio_iodev_sqe_err(iodev_sqe, (int)rc);
+	} else {
+		rtio_iodev_sqe_ok(iodev_sqe, (int)rc);
+	}
+}
+
+static void fs_rtio_thread_fn(void *arg1, void *arg2, void *arg3)
+{
+	struct fs_rtio_worker *worker = arg1;
+	struct mpsc_node *node;
+	k_spinlock_key_t key;
+
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	while (true) {
+		k_sem_take(&worker->pending, K_FOREVER);
+
+		key = k_spin_lock(&worker->lock);
+		node = mpsc_pop(&worker->queue);
+		k_spin_unlock(&worker->lock, key);
+
+		if (node != NULL) {
+			fs_rtio_execute(CONTAINER_OF(node, struct rtio_iodev_sqe, q));
+		}
+	}
+}
+
+static void fs_rtio_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct fs_rtio_file *data = iodev_sqe->sqe.iodev->data;
+	struct fs_rtio_worker *worker;
+	k_spinlock_key_t key;
+
+	if ((data->file == NULL) || (data->file->mp == NULL)) {
+		rtio_iodev_sqe_err(iodev_sqe, -EBADF);
+		return;
+	}
+
+	worker = fs_rtio_worker_get(data->file->mp);
+
+	/* Pushing under the lock keeps the queue consistent for the worker's pop */
+	key = k_spin_lock(&worker->lock);
+	mpsc_push(&worker->queue, &iodev_sqe->q);
+	k_spin_unlock(&worker->lock, key);
+
+	k_sem_give(&worker->pending);
+}
+
+const struct rtio_iodev_api fs_rtio_iodev_api = {
+	.submit = fs_rtio_submit,
+};
+
+static int fs_rtio_init(void)
+{
+	struct fs_rtio_worker *worker;
+
+	for (size_t i = 0; i < ARRAY_SIZE(fs_rtio_workers); i++) {
+		worker = &fs_rtio_workers[i];
+
+		mpsc_init(&worker->queue);
+		k_sem_init(&worker->pending, 0, K_SEM_MAX_LIMIT);
+		k_thread_create(&worker->thread, fs_rtio_stacks[i],
+				K_THREAD_STACK_SIZEOF(fs_rtio_stacks[i]), fs_rtio_thread_fn,
+				worker, NULL, NULL, CONFIG_FILE_SYSTEM_RTIO_THREAD_PRIO, 0,
+				K_NO_WAIT);
+		k_thread_name_set(&worker->thread, "fs_rtio");
+	}
+
+	return 0;
+}
+
+SYS_INIT(fs_rtio_init, POST_KERNEL, CONFIG_FILE_SYSTEM_INIT_PRIORITY);
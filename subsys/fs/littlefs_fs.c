@@ -76,17 +76,29 @@ static inline bool littlefs_on_blkdev(int flags)
 	return (flags & FS_MOUNT_FLAG_USE_DISK_ACCESS) ? true : false;
 }
 
-static inline void *fc_allocate(size_t size)
+static inline void *fc_allocate(struct fs_littlefs *fs, size_t size)
 {
 	void *ret = NULL;
 
+	if (fs->file_cache != NULL) {
+		if (k_mem_slab_alloc(fs->file_cache, &ret, K_NO_WAIT) != 0) {
+			ret = NULL;
+		}
+		return ret;
+	}
+
 	ret = k_heap_alloc(&file_cache_heap, size, K_NO_WAIT);
 
 	return ret;
 }
 
-static inline void fc_release(void *buf)
+static inline void fc_release(struct fs_littlefs *fs, void *buf)
 {
+	if (fs->file_cache != NULL) {
+		k_mem_slab_free(fs->file_cache, buf);
+		return;
+	}
+
 	k_heap_free(&file_cache_heap, buf);
 }
 
@@ -266,7 +278,7 @@ static void release_file_data(struct fs_file_t *fp)
 	struct lfs_file_data *fdp = fp->filep;
 
 	if (fdp->config.buffer) {
-		fc_release(fdp->cache_block);
+		fc_release(fp->mp->fs_data, fdp->cache_block);
 	}
 
 	k_mem_slab_free(&file_data_pool, fp->filep);
@@ -304,7 +316,7 @@ static int littlefs_open(struct fs_file_t *fp, const char *path,
 
 	memset(fdp, 0, sizeof(*fdp));
 
-	fdp->cache_block = fc_allocate(lfs->cfg->cache_size);
+	fdp->cache_block = fc_allocate(fs, lfs->cfg->cache_size);
 	if (fdp->cache_block == NULL) {
 		ret = -ENOMEM;
 		goto out;
@@ -962,6 +974,14 @@ static int littlefs_mount(struct fs_mount_t *mountp)
 		goto out;
 	}
 
+	if ((fs->file_cache != NULL) &&
+	    (fs->file_cache->info.block_size < fs->cfg.cache_size)) {
+		LOG_ERR("file cache blocks too small: %zu < %u",
+			fs->file_cache->info.block_size, fs->cfg.cache_size);
+		ret = -EINVAL;
+		goto out;
+	}
+
 	/* Mount it, formatting if needed. */
 	ret = lfs_mount(&fs->lfs, &fs->cfg);
 	if (ret < 0 &&
@@ -1100,7 +1120,16 @@ static const struct fs_file_system_t littlefs_fs = {
 #define FS_DISK_VERSION(inst)
 #endif
 
+#define FS_FILE_CACHE_DEFINE(inst) \
+	K_MEM_SLAB_DEFINE_STATIC(file_cache_##inst, \
+				 ROUND_UP(DT_INST_PROP(inst, cache_size), 4), \
+				 DT_INST_PROP(inst, file_cache_count), 4);
+#define FS_FILE_CACHE(inst) \
+	.file_cache = COND_CODE_1(DT_INST_NODE_HAS_PROP(inst, file_cache_count), \
+				  (&file_cache_##inst), (NULL)),
+
 #define DEFINE_FS(inst) \
+IF_ENABLED(DT_INST_NODE_HAS_PROP(inst, file_cache_count), (FS_FILE_CACHE_DEFINE(inst))) \
 static uint8_t __aligned(4) \
 	read_buffer_##inst[DT_INST_PROP(inst, cache_size)]; \
 static uint8_t __aligned(4) \
@@ -1128,6 +1157,7 @@ static struct fs_littlefs fs_data_##inst = { \
 		.lookahead_buffer = lookahead_buffer_##inst, \
 		FS_DISK_VERSION(inst) \
 	}, \
+	FS_FILE_CACHE(inst) \
 }; \
 struct fs_mount_t FS_FSTAB_ENTRY(DT_DRV_INST(inst)) = { \
 	.type = FS_LITTLEFS, \
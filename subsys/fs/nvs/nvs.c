@@ -634,6 +634,8 @@ static int nvs_gc(struct nvs_fs *fs)
 
 	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
 
+	fs->gc_count++;
+
 	sec_addr = (fs->ate_wra & ADDR_SECT_MASK);
 	nvs_sector_advance(fs, &sec_addr);
 	gc_addr = sec_addr + fs->sector_size - ate_size;
@@ -745,6 +747,65 @@ gc_done:
 	return rc;
 }
 
+/* close the active sector and garbage collect the sector after it */
+static int nvs_sector_switch(struct nvs_fs *fs)
+{
+	int rc;
+
+	rc = nvs_sector_close(fs);
+	if (rc) {
+		return rc;
+	}
+
+	rc = nvs_gc(fs);
+
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	fs->gc_free_start = fs->ate_wra - fs->data_wra;
+#endif
+
+	return rc;
+}
+
+#ifdef CONFIG_NVS_BACKGROUND_GC
+/* Background gc is worthwhile when the active sector is running out of space.
+ * A sector that was mostly filled by entries moved by gc is not closed again
+ * until gc_threshold bytes have been written to it, as that would only add
+ * erase cycles.
+ */
+static bool nvs_background_gc_needed(struct nvs_fs *fs)
+{
+	uint32_t free_space = fs->ate_wra - fs->data_wra;
+
+	if (fs->gc_forced) {
+		return true;
+	}
+
+	return (fs->gc_threshold > 0U) && (free_space < fs->gc_threshold) &&
+	       ((fs->gc_free_start - free_space) >= fs->gc_threshold);
+}
+
+static void nvs_background_gc(struct k_work *work)
+{
+	struct nvs_fs *fs = CONTAINER_OF(work, struct nvs_fs, gc_work);
+	int rc;
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+
+	if (fs->ready && nvs_background_gc_needed(fs)) {
+		LOG_DBG("Background gc of sector %d",
+			((fs->ate_wra >> ADDR_SECT_SHIFT) + 1) % fs->sector_count);
+		rc = nvs_sector_switch(fs);
+		if (rc) {
+			LOG_ERR("Background gc failed (%d)", rc);
+		}
+	}
+
+	fs->gc_forced = false;
+
+	k_mutex_unlock(&fs->nvs_lock);
+}
+#endif /* CONFIG_NVS_BACKGROUND_GC */
+
 static int nvs_startup(struct nvs_fs *fs)
 {
 	int rc;
@@ -983,12 +1044,21 @@ int nvs_clear(struct nvs_fs *fs)
 {
 	int rc;
 	uint32_t addr;
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	struct k_work_sync sync;
+#endif
 
 	if (!fs->ready) {
 		LOG_ERR("NVS not initialized");
 		return -EACCES;
 	}
 
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	(void)k_work_cancel_sync(&fs->gc_work, &sync);
+#endif
+
+	fs->gc_count++;
+
 	for (uint16_t i = 0; i < fs->sector_count; i++) {
 		addr = i << ADDR_SECT_SHIFT;
 		rc = nvs_flash_erase_sector(fs, addr);
@@ -1009,6 +1079,19 @@ int nvs_mount(struct nvs_fs *fs)
 	struct flash_pages_info info;
 	size_t write_block_size;
 
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	if (fs->ready) {
+		struct k_work_sync sync;
+
+		/* Remount, make sure no gc runs on the old state */
+		(void)k_work_cancel_sync(&fs->gc_work, &sync);
+	}
+
+	k_work_init(&fs->gc_work, nvs_background_gc);
+	fs->gc_forced = false;
+	fs->gc_free_start = fs->sector_size;
+#endif
+
 	k_mutex_init(&fs->nvs_lock);
 
 	fs->flash_parameters = flash_get_parameters(fs->flash_device);
@@ -1068,7 +1151,8 @@ int nvs_mount(struct nvs_fs *fs)
 	return 0;
 }
 
-ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
+static ssize_t nvs_write_entry(struct nvs_fs *fs, uint16_t id, const void *data, size_t len,
+			       bool nowait)
 {
 	int rc, gc_count;
 	size_t ate_size, data_size;
@@ -1164,7 +1248,14 @@ no_cached_entry:
 		required_space = data_size + ate_size + NVS_DATA_CRC_SIZE;
 	}
 
-	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+	if (nowait) {
+		/* Do not wait for a garbage collection that is in progress */
+		if (k_mutex_lock(&fs->nvs_lock, K_NO_WAIT) != 0) {
+			return -EAGAIN;
+		}
+	} else {
+		k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+	}
 
 	gc_count = 0;
 	while (1) {
@@ -1191,29 +1282,94 @@ no_cached_entry:
 			break;
 		}
 
-
-		rc = nvs_sector_close(fs);
-		if (rc) {
+#ifdef CONFIG_NVS_BACKGROUND_GC
+		if (nowait) {
+			/* Leave the gc to the work item */
+			fs->gc_forced = true;
+			k_work_submit(&fs->gc_work);
+			rc = -EAGAIN;
 			goto end;
 		}
+#endif
 
-		rc = nvs_gc(fs);
+		rc = nvs_sector_switch(fs);
 		if (rc) {
 			goto end;
 		}
 		gc_count++;
 	}
+
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	if (nvs_background_gc_needed(fs)) {
+		k_work_submit(&fs->gc_work);
+	}
+#endif
+
 	rc = len;
 end:
 	k_mutex_unlock(&fs->nvs_lock);
 	return rc;
 }
 
+ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
+{
+	return nvs_write_entry(fs, id, data, len, false);
+}
+
+#ifdef CONFIG_NVS_BACKGROUND_GC
+ssize_t nvs_write_nowait(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
+{
+	return nvs_write_entry(fs, id, data, len, true);
+}
+#endif
+
 int nvs_delete(struct nvs_fs *fs, uint16_t id)
 {
 	return nvs_write(fs, id, NULL, 0);
 }
 
+/* read the data of the entry described by ate, which is stored at ate_addr */
+static ssize_t nvs_ate_data_rd(struct nvs_fs *fs, uint32_t ate_addr, const struct nvs_ate *ate,
+			       void *data, size_t len)
+{
+	int rc;
+	uint32_t rd_addr;
+#ifdef CONFIG_NVS_DATA_CRC
+	uint32_t read_data_crc, computed_data_crc;
+
+	/* When data CRC is enabled, there should be at least the CRC stored in the data field */
+	if (ate->len < NVS_DATA_CRC_SIZE) {
+		return -ENOENT;
+	}
+#endif
+
+	rd_addr = (ate_addr & ADDR_SECT_MASK) + ate->offset;
+	rc = nvs_flash_rd(fs, rd_addr, data, MIN(len, ate->len - NVS_DATA_CRC_SIZE));
+	if (rc) {
+		return rc;
+	}
+
+	/* Check data CRC (only if the whole element data has been read) */
+#ifdef CONFIG_NVS_DATA_CRC
+	if (len >= (ate->len - NVS_DATA_CRC_SIZE)) {
+		rd_addr += ate->len - NVS_DATA_CRC_SIZE;
+		rc = nvs_flash_rd(fs, rd_addr, &read_data_crc, sizeof(read_data_crc));
+		if (rc) {
+			return rc;
+		}
+
+		computed_data_crc = crc32_ieee(data, ate->len - NVS_DATA_CRC_SIZE);
+		if (read_data_crc != computed_data_crc) {
+			LOG_ERR("Invalid data CRC: read_data_crc=0x%08X, computed_data_crc=0x%08X",
+				read_data_crc, computed_data_crc);
+			return -EIO;
+		}
+	}
+#endif
+
+	return ate->len - NVS_DATA_CRC_SIZE;
+}
+
 ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len,
 		      uint16_t cnt)
 {
@@ -1222,9 +1378,6 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len,
 	uint16_t cnt_his;
 	struct nvs_ate wlk_ate;
 	size_t ate_size;
-#ifdef CONFIG_NVS_DATA_CRC
-	uint32_t read_data_crc, computed_data_crc;
-#endif
 
 	if (!fs->ready) {
 		LOG_ERR("NVS not initialized");
@@ -1270,51 +1423,86 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len,
 		return -ENOENT;
 	}
 
-#ifdef CONFIG_NVS_DATA_CRC
-	/* When data CRC is enabled, there should be at least the CRC stored in the data field */
-	if (wlk_ate.len < NVS_DATA_CRC_SIZE) {
-		return -ENOENT;
-	}
-#endif
+	return nvs_ate_data_rd(fs, rd_addr, &wlk_ate, data, len);
 
-	rd_addr &= ADDR_SECT_MASK;
-	rd_addr += wlk_ate.offset;
-	rc = nvs_flash_rd(fs, rd_addr, data, MIN(len, wlk_ate.len - NVS_DATA_CRC_SIZE));
-	if (rc) {
-		goto err;
+err:
+	return rc;
+}
+
+ssize_t nvs_read(struct nvs_fs *fs, uint16_t id, void *data, size_t len)
+{
+	int rc;
+
+	rc = nvs_read_hist(fs, id, data, len, 0);
+	return rc;
+}
+
+int nvs_walk(struct nvs_fs *fs, nvs_walk_cb_t cb, void *arg)
+{
+	int rc;
+	uint32_t wlk_addr, rd_addr;
+	struct nvs_ate wlk_ate;
+	struct nvs_walk_entry entry;
+
+	if (!fs->ready) {
+		LOG_ERR("NVS not initialized");
+		return -EACCES;
 	}
 
-	/* Check data CRC (only if the whole element data has been read) */
-#ifdef CONFIG_NVS_DATA_CRC
-	if (len >= (wlk_ate.len - NVS_DATA_CRC_SIZE)) {
-		rd_addr += wlk_ate.len - NVS_DATA_CRC_SIZE;
-		rc = nvs_flash_rd(fs, rd_addr, &read_data_crc, sizeof(read_data_crc));
+	/* The walk starts at the erased ate following the newest entry and
+	 * ends when nvs_prev_ate() wraps around to it again, so every ate is
+	 * read exactly once.
+	 */
+	wlk_addr = fs->ate_wra;
+	do {
+		rd_addr = wlk_addr;
+		rc = nvs_prev_ate(fs, &wlk_addr, &wlk_ate);
 		if (rc) {
-			goto err;
+			return rc;
 		}
 
-		computed_data_crc = crc32_ieee(data, wlk_ate.len - NVS_DATA_CRC_SIZE);
-		if (read_data_crc != computed_data_crc) {
-			LOG_ERR("Invalid data CRC: read_data_crc=0x%08X, computed_data_crc=0x%08X",
-				read_data_crc, computed_data_crc);
-			rc = -EIO;
-			goto err;
+		if ((wlk_ate.id == 0xFFFF) || !nvs_ate_valid(fs, &wlk_ate)) {
+			continue;
 		}
-	}
-#endif
 
-	return wlk_ate.len - NVS_DATA_CRC_SIZE;
+		entry.id = wlk_ate.id;
+		entry.len = (wlk_ate.len < NVS_DATA_CRC_SIZE) ? 0 :
+			    (wlk_ate.len - NVS_DATA_CRC_SIZE);
+		entry.ate_addr = rd_addr;
 
-err:
-	return rc;
+		rc = cb(&entry, arg);
+		if (rc) {
+			return rc;
+		}
+	} while (wlk_addr != fs->ate_wra);
+
+	return 0;
 }
 
-ssize_t nvs_read(struct nvs_fs *fs, uint16_t id, void *data, size_t len)
+ssize_t nvs_walk_read(struct nvs_fs *fs, const struct nvs_walk_entry *entry, void *data,
+		      size_t len)
 {
 	int rc;
+	struct nvs_ate ate;
 
-	rc = nvs_read_hist(fs, id, data, len, 0);
-	return rc;
+	if (!fs->ready) {
+		LOG_ERR("NVS not initialized");
+		return -EACCES;
+	}
+
+	/* The entry may have been moved by garbage collection since it was
+	 * reported, so verify that it is still at its place.
+	 */
+	rc = nvs_flash_ate_rd(fs, entry->ate_addr, &ate);
+	if (rc) {
+		return rc;
+	}
+
+	if ((ate.id != entry->id) || !nvs_ate_valid(fs, &ate) || (ate.len == 0U)) {
+		return -ENOENT;
+	}
+
+	return nvs_ate_data_rd(fs, entry->ate_addr, &ate, data, len);
 }
 
 ssize_t nvs_calc_free_space(struct nvs_fs *fs)
@@ -1405,14 +1593,13 @@ int nvs_sector_use_next(struct nvs_fs *fs)
 
 	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
 
-	ret = nvs_sector_close(fs);
-	if (ret != 0) {
-		goto end;
-	}
-
-	ret = nvs_gc(fs);
+	ret = nvs_sector_switch(fs);
 
-end:
 	k_mutex_unlock(&fs->nvs_lock);
 	return ret;
 }
+
+uint32_t nvs_gc_count_get(struct nvs_fs *fs)
+{
+	return fs->gc_count;
+}
@@ -532,6 +532,20 @@ static bool zms_sector_closed(struct zms_fs *fs, struct zms_ate *empty_ate,
 		(empty_ate->cycle_cnt == close_ate->cycle_cnt));
 }
 
+/* zms_batch_marker returns the type of a batch marker ATE (ZMS_BATCH_BEGIN,
+ * ZMS_BATCH_END or ZMS_BATCH_ABORT), 0 if the ATE is not a batch marker.
+ * The validity of the ATE is not checked.
+ */
+static uint32_t zms_batch_marker(const struct zms_ate *entry)
+{
+	if ((entry->id == ZMS_HEAD_ID) && (!entry->len) && (entry->offset >= ZMS_BATCH_BEGIN) &&
+	    (entry->offset <= ZMS_BATCH_ABORT)) {
+		return entry->offset;
+	}
+
+	return 0;
+}
+
 /* Read empty and close ATE of the sector where belongs address "addr" and
  * validates that the sector is closed.
  * retval: 0 if sector is not close
@@ -678,6 +692,49 @@ static int zms_compute_prev_addr(struct zms_fs *fs, uint64_t *addr)
 	return 0;
 }
 
+/* The entries of an aborted batch are hidden by moving addr from the ABORT
+ * marker to the BEGIN marker of the batch, which is in the same sector.
+ * retval: 1 if addr was moved to the BEGIN marker
+ * retval: 0 if abort_ate is not a valid ABORT marker or has no BEGIN marker
+ * retval: < 0 if a read failed
+ */
+static int zms_batch_skip_aborted(struct zms_fs *fs, uint64_t *addr,
+				  const struct zms_ate *abort_ate)
+{
+	int rc;
+	uint64_t wlk_addr;
+	uint64_t stop_addr;
+	struct zms_ate wlk_ate;
+	uint8_t cycle_cnt;
+
+	rc = zms_get_sector_cycle(fs, *addr, &cycle_cnt);
+	if (rc == -ENOENT) {
+		return 0;
+	} else if (rc) {
+		return rc;
+	}
+
+	if (!zms_ate_valid_different_sector(fs, abort_ate, cycle_cnt)) {
+		return 0;
+	}
+
+	stop_addr = zms_close_ate_addr(fs, *addr);
+	for (wlk_addr = *addr + fs->ate_size; wlk_addr < stop_addr; wlk_addr += fs->ate_size) {
+		rc = zms_flash_ate_rd(fs, wlk_addr, &wlk_ate);
+		if (rc) {
+			return rc;
+		}
+
+		if (zms_ate_valid_different_sector(fs, &wlk_ate, cycle_cnt) &&
+		    (zms_batch_marker(&wlk_ate) == ZMS_BATCH_BEGIN)) {
+			*addr = wlk_addr;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
 /* walking through allocation entry list, from newest to oldest entries
  * read ate from addr, modify addr to the previous ate
  */
@@ -690,6 +747,16 @@ static int zms_prev_ate(struct zms_fs *fs, uint64_t *addr, struct zms_ate *ate)
 		return rc;
 	}
 
+	if (zms_batch_marker(ate) == ZMS_BATCH_ABORT) {
+		rc = zms_batch_skip_aborted(fs, addr, ate);
+		if (rc < 0) {
+			return rc;
+		} else if (rc) {
+			/* next read returns the BEGIN marker */
+			return 0;
+		}
+	}
+
 	return zms_compute_prev_addr(fs, addr);
 }
 
@@ -778,6 +845,64 @@ static int zms_add_gc_done_ate(struct zms_fs *fs)
 	return zms_flash_ate_wrt(fs, &gc_done_ate);
 }
 
+static int zms_add_batch_ate(struct zms_fs *fs, uint32_t marker)
+{
+	struct zms_ate batch_ate;
+
+	/* Initialize all members to 0xff */
+	memset(&batch_ate, 0xff, sizeof(struct zms_ate));
+
+	batch_ate.id = ZMS_HEAD_ID;
+	batch_ate.len = 0U;
+	batch_ate.offset = marker;
+	batch_ate.cycle_cnt = fs->sector_cycle;
+
+	zms_ate_crc8_update(&batch_ate);
+
+	return zms_flash_ate_wrt(fs, &batch_ate);
+}
+
+/* A batch is always written in the active sector, so a batch interrupted by a
+ * power loss is found there: it has a BEGIN marker that is not followed by an
+ * END or ABORT marker. Close it with an ABORT marker, which uses the space
+ * that the batch reserved for its END marker.
+ */
+static int zms_batch_recover(struct zms_fs *fs)
+{
+	int rc;
+	uint64_t addr;
+	uint64_t stop_addr;
+	struct zms_ate ate;
+
+	stop_addr = zms_close_ate_addr(fs, fs->ate_wra);
+	for (addr = fs->ate_wra + fs->ate_size; addr < stop_addr; addr += fs->ate_size) {
+		rc = zms_flash_ate_rd(fs, addr, &ate);
+		if (rc) {
+			return rc;
+		}
+
+		if (!zms_ate_valid(fs, &ate)) {
+			continue;
+		}
+
+		switch (zms_batch_marker(&ate)) {
+		case ZMS_BATCH_BEGIN:
+			if ((fs->ate_wra < fs->data_wra) || !SECTOR_OFFSET(fs->ate_wra)) {
+				return -ESPIPE;
+			}
+			LOG_INF("Aborting interrupted batch write");
+			return zms_add_batch_ate(fs, ZMS_BATCH_ABORT);
+		case ZMS_BATCH_END:
+		case ZMS_BATCH_ABORT:
+			return 0;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
 /* This function verifies that the cycle_cnt of the close ATE will not be equal
  * to the cycle_cnt of the empty ATE after incrementing it.
  * This is possible only in these extreme conditions:
@@ -1442,6 +1567,8 @@ static int zms_init(struct zms_fs *fs)
 		goto end;
 	}
 
+	rc = zms_batch_recover(fs);
+
 end:
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
 	if (!rc) {
@@ -1685,6 +1812,138 @@ end:
 	return rc;
 }
 
+/* Compute the space a batch takes in a sector, return -EINVAL if it is invalid */
+static int zms_batch_space(struct zms_fs *fs, const struct zms_batch_entry *entries, size_t count,
+			   uint64_t *required_space)
+{
+	if ((entries == NULL) || (count == 0U)) {
+		return -EINVAL;
+	}
+
+	/* one ATE per entry plus the BEGIN and END markers */
+	*required_space = (uint64_t)(count + 2U) * fs->ate_size;
+	for (size_t i = 0; i < count; i++) {
+		if ((entries[i].len > UINT16_MAX) ||
+		    ((entries[i].len > 0) && (entries[i].data == NULL))) {
+			return -EINVAL;
+		}
+		if (entries[i].len > ZMS_DATA_IN_ATE_SIZE) {
+			*required_space += zms_al_size(fs, entries[i].len);
+		}
+	}
+
+	/* The whole batch has to fit into one sector next to the empty, close and
+	 * gc done ATEs, and leave one ATE for a delete.
+	 */
+	if (*required_space > (fs->sector_size - 4 * fs->ate_size)) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+bool zms_batch_fits(struct zms_fs *fs, const struct zms_batch_entry *entries, size_t count)
+{
+	uint64_t required_space;
+
+	if ((fs == NULL) || !fs->ready) {
+		return false;
+	}
+
+	return zms_batch_space(fs, entries, count, &required_space) == 0;
+}
+
+ssize_t zms_write_batch(struct zms_fs *fs, const struct zms_batch_entry *entries, size_t count)
+{
+	int rc;
+	size_t i;
+	size_t data_len = 0U;
+	uint32_t gc_count;
+	uint64_t required_space;
+
+	if (!fs) {
+		LOG_ERR("Invalid fs");
+		return -EINVAL;
+	}
+
+	if (!fs->ready) {
+		LOG_ERR("zms not initialized");
+		return -EACCES;
+	}
+
+	rc = zms_batch_space(fs, entries, count, &required_space);
+	if (rc) {
+		return rc;
+	}
+
+	for (i = 0; i < count; i++) {
+		data_len += entries[i].len;
+	}
+
+	k_mutex_lock(&fs->zms_lock, K_FOREVER);
+
+	gc_count = 0;
+	while (1) {
+		if (gc_count == fs->sector_count) {
+			/* gc'ed all sectors, no extra space will be created
+			 * by extra gc.
+			 */
+			rc = -ENOSPC;
+			goto end;
+		}
+
+		/* Same rule as in zms_write(): the ATE left free after the batch for a
+		 * delete must not be the one at address 0x0 of the sector.
+		 */
+		if ((fs->ate_wra >= (fs->data_wra + required_space)) &&
+		    SECTOR_OFFSET(fs->ate_wra - (count + 2U) * fs->ate_size)) {
+			break;
+		}
+		rc = zms_sector_close(fs);
+		if (rc) {
+			LOG_ERR("Failed to close the sector, returned = %d", rc);
+			goto end;
+		}
+		rc = zms_gc(fs);
+		if (rc) {
+			LOG_ERR("Garbage collection failed, returned = %d", rc);
+			goto end;
+		}
+		gc_count++;
+	}
+
+	rc = zms_add_batch_ate(fs, ZMS_BATCH_BEGIN);
+	if (rc) {
+		goto end;
+	}
+
+	for (i = 0; i < count; i++) {
+		rc = zms_flash_write_entry(fs, entries[i].id, entries[i].data, entries[i].len);
+		if (rc) {
+			goto abort;
+		}
+	}
+
+	rc = zms_add_batch_ate(fs, ZMS_BATCH_END);
+	if (rc) {
+		goto abort;
+	}
+
+	rc = data_len;
+	goto end;
+
+abort:
+	LOG_ERR("Batch write failed, returned = %d", rc);
+	/* Hide the entries that were written, the END marker space is still free */
+	(void)zms_add_batch_ate(fs, ZMS_BATCH_ABORT);
+#ifdef CONFIG_ZMS_LOOKUP_CACHE
+	(void)zms_lookup_cache_rebuild(fs);
+#endif
+end:
+	k_mutex_unlock(&fs->zms_lock);
+	return rc;
+}
+
 int zms_delete(struct zms_fs *fs, zms_id_t id)
 {
 	return zms_write(fs, id, NULL, 0);
@@ -41,6 +41,16 @@
 
 #define ZMS_INVALID_SECTOR_NUM -1
 
+/*
+ * Batch markers are ATEs with id = ZMS_HEAD_ID, len = 0 and one of these
+ * values in the offset field. The entries of a batch are written between a
+ * BEGIN and an END marker. A batch that was interrupted is closed with an
+ * ABORT marker when mounting, its entries are then ignored.
+ */
+#define ZMS_BATCH_BEGIN 0xffffff01U
+#define ZMS_BATCH_END   0xffffff02U
+#define ZMS_BATCH_ABORT 0xffffff03U
+
 #define ZMS_ATE_FORMAT_ID_32BIT 0
 #define ZMS_ATE_FORMAT_ID_64BIT 1
 
@@ -70,6 +70,15 @@ struct disco_func_entry {
 static int num_disco_func;
 struct disco_func_entry disco_func[MAX_NUM_DISCO_FUNC] = { 0 };
 
+/*
+ * Open addressing hash index of the discovered functions, holding the index
+ * in 'disco_func' plus one (0 marks an empty slot). It is at least twice the
+ * size of 'disco_func' so a lookup always ends on an empty slot, and it
+ * avoids a linear search of 'disco_func' on every function entry and exit.
+ */
+#define DISCO_HASH_SIZE NHPOT(2 * MAX_NUM_DISCO_FUNC)
+static uint16_t disco_hash[DISCO_HASH_SIZE];
+
 /* To track the number of unbalanced/spurious entry/exist pairs, for debugging */
 static int unbalanced;
 #endif
@@ -93,6 +102,10 @@ static void *k_stopper_callee = INSTR_STOPPER_FUNCTION;
 static void *trigger_callee;
 static void *stopper_callee;
 
+/* Only functions in [filter_start, filter_end) generate events, if set */
+static void *filter_start;
+static void *filter_end;
+
 bool instr_tracing_supported(void)
 {
 	return _instr_tracing_supported;
@@ -289,6 +302,38 @@ void *instr_get_stop_func(void)
 	return stopper_callee;
 }
 
+__no_instrumentation__
+void instr_set_filter(void *start, void *end)
+{
+	filter_start = start;
+	filter_end = end;
+}
+
+__no_instrumentation__
+void instr_get_filter(void **start, void **end)
+{
+	*start = filter_start;
+	*end = filter_end;
+}
+
+__no_instrumentation__
+static bool instr_callee_filtered(void *callee)
+{
+	if (filter_end == NULL) {
+		return false;
+	}
+
+#if defined(CONFIG_INSTRUMENTATION_MODE_CALLGRAPH)
+	/* Context switches are always traced */
+	if (callee == z_thread_mark_switched_in || callee == z_thread_mark_switched_out) {
+		return false;
+	}
+#endif
+
+	return ((uintptr_t)callee < (uintptr_t)filter_start) ||
+	       ((uintptr_t)callee >= (uintptr_t)filter_end);
+}
+
 __no_instrumentation__
 void instr_dump_buffer_uart(void)
 {
@@ -354,40 +399,55 @@ void instr_dump_deltas_uart(void)
 
 #if defined(CONFIG_INSTRUMENTATION_MODE_STATISTICAL)
 __no_instrumentation__
-void push_callee_timestamp(void *callee)
+static struct disco_func_entry *disco_func_find(void *callee, bool add)
 {
-	bool found = false;
-	int curr_func;
-
-	/* Find callee in the discovered function array */
-	for (curr_func = 0; curr_func < num_disco_func; curr_func++) {
-		if (disco_func[curr_func].addr == callee) {
-			found = true;
-			break;
+	uint32_t hash = ((uint32_t)(uintptr_t)callee >> 1) * 2654435761U;
+	uint32_t slot = (hash ^ (hash >> 16)) & (DISCO_HASH_SIZE - 1);
+	struct disco_func_entry *entry;
+
+	while (disco_hash[slot] != 0) {
+		entry = &disco_func[disco_hash[slot] - 1];
+		if (entry->addr == callee) {
+			return entry;
 		}
+
+		slot = (slot + 1) & (DISCO_HASH_SIZE - 1);
 	}
 
-	if (!found) { /* New function discovered */
-		if (num_disco_func >= MAX_NUM_DISCO_FUNC) {
-			/* No more space to add another function */
-			return;
-		}
+	if (!add || num_disco_func >= MAX_NUM_DISCO_FUNC) {
+		/* Unknown function or no more space to add another function */
+		return NULL;
+	}
 
-		disco_func[curr_func].delta_t = 0;
-		disco_func[curr_func].call_depth = 0;
-		disco_func[curr_func].addr = callee;
+	/* New function discovered */
+	entry = &disco_func[num_disco_func];
+	entry->delta_t = 0;
+	entry->call_depth = 0;
+	entry->addr = callee;
 
-		num_disco_func++;
+	num_disco_func++;
+	disco_hash[slot] = (uint16_t)num_disco_func;
+
+	return entry;
+}
+
+__no_instrumentation__
+void push_callee_timestamp(void *callee)
+{
+	struct disco_func_entry *entry = disco_func_find(callee, true);
+
+	if (entry == NULL) {
+		return;
 	}
 
 	/* New function or no other instance of function active (called): record timestamp */
-	if (disco_func[curr_func].call_depth == 0) {
-		disco_func[curr_func].entry_timestamp = instr_timestamp_ns();
+	if (entry->call_depth == 0) {
+		entry->entry_timestamp = instr_timestamp_ns();
 	}
 
 	/* Update call depth if not reached out maximum call depth */
-	if (disco_func[curr_func].call_depth < MAX_CALL_DEPTH) {
-		disco_func[curr_func].call_depth++;
+	if (entry->call_depth < MAX_CALL_DEPTH) {
+		entry->call_depth++;
 	}
 }
 
@@ -397,31 +457,27 @@ void pop_callee_timestamp(void *callee)
 	uint64_t dt_ns;
 	uint64_t entry_timestamp;
 	uint64_t exit_timestamp;
-	int curr_func;
-
-	for (curr_func = 0; curr_func < num_disco_func; curr_func++) {
-		if (disco_func[curr_func].addr == callee) {
-			disco_func[curr_func].call_depth--;
+	struct disco_func_entry *entry = disco_func_find(callee, false);
 
-			/* Last active function is returning */
-			if (disco_func[curr_func].call_depth == 0) {
-				entry_timestamp = disco_func[curr_func].entry_timestamp;
-				exit_timestamp = instr_timestamp_ns(); /* Now */
+	if (entry == NULL) {
+		/* Track number of unbalanced/spurious function exits */
+		unbalanced++;
+		return;
+	}
 
-				/* Compute delta T */
-				dt_ns = exit_timestamp - entry_timestamp;
+	entry->call_depth--;
 
-				/* Accumulate delta T */
-				disco_func[curr_func].delta_t += dt_ns;
+	/* Last active function is returning */
+	if (entry->call_depth == 0) {
+		entry_timestamp = entry->entry_timestamp;
+		exit_timestamp = instr_timestamp_ns(); /* Now */
 
-			}
+		/* Compute delta T */
+		dt_ns = exit_timestamp - entry_timestamp;
 
-			return;
-		}
+		/* Accumulate delta T */
+		entry->delta_t += dt_ns;
 	}
-
-	/* Track number of unbalanced/spurious function exits */
-	unbalanced++;
 }
 #endif
 
@@ -554,6 +610,10 @@ void instr_event_handler(enum instr_event_types type, void *callee, void *caller
 		return;
 	}
 
+	if (instr_callee_filtered(callee)) {
+		return;
+	}
+
 	/* Enter critical section */
 	instr_disable();
 
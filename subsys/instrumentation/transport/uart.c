@@ -51,6 +51,24 @@ void handle_cmd(char *cmd, uint32_t length)
 		} else {
 			printk("stopper: invalid argument in: '%s'\n", cmd);
 		}
+	} else if (strncmp(cmd, "filter", strlen("filter")) == 0) {
+		void *start;
+
+		beginptr = cmd + strlen("filter");
+		address = strtol(beginptr, &endptr, 16);
+		if (endptr == beginptr) {
+			/* No range given, remove the filter */
+			instr_set_filter(NULL, NULL);
+		} else {
+			start = (void *)address;
+			beginptr = endptr;
+			address = strtol(beginptr, &endptr, 16);
+			if (endptr != beginptr) {
+				instr_set_filter(start, (void *)address);
+			} else {
+				printk("filter: invalid argument in: '%s'\n", cmd);
+			}
+		}
 	} else if (strncmp("listsets", cmd, length) == 0) {
 		void *address;
 
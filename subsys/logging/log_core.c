@@ -142,6 +142,37 @@ static const struct mpsc_pbuf_buffer_config mpsc_config = {
 };
 #endif
 
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+/* CPU 0 uses the default buffer, buffer n is used by CPU n + 1. */
+#define LOG_CPU_BUFFER_DEFINE(n, _)							\
+	static uint32_t __aligned(Z_LOG_MSG_ALIGNMENT)					\
+		log_cpu##n##_buf32[CONFIG_LOG_PER_CPU_BUFFER_SIZE / sizeof(int)];	\
+	static const struct mpsc_pbuf_buffer_config log_cpu##n##_mpsc_config = {	\
+		.buf = (uint32_t *)log_cpu##n##_buf32,					\
+		.size = ARRAY_SIZE(log_cpu##n##_buf32),					\
+		.notify_drop = z_log_notify_drop,					\
+		.get_wlen = log_msg_generic_get_wlen,					\
+		.flags = IS_ENABLED(CONFIG_LOG_MODE_OVERFLOW) ?				\
+			 MPSC_PBUF_MODE_OVERWRITE : 0					\
+	};										\
+	static STRUCT_SECTION_ITERABLE(log_msg_ptr, log_cpu##n##_msg_ptr);		\
+	static STRUCT_SECTION_ITERABLE_ALTERNATE(log_mpsc_pbuf, mpsc_pbuf_buffer,	\
+						 log_cpu##n##_buffer)
+
+#define LOG_CPU_BUFFER_PTR(n, _) &log_cpu##n##_buffer
+#define LOG_CPU_CONFIG_PTR(n, _) &log_cpu##n##_mpsc_config
+
+LISTIFY(UTIL_DEC(CONFIG_MP_MAX_NUM_CPUS), LOG_CPU_BUFFER_DEFINE, (;), _);
+
+static struct mpsc_pbuf_buffer *const cpu_log_buffers[] = {
+	LISTIFY(UTIL_DEC(CONFIG_MP_MAX_NUM_CPUS), LOG_CPU_BUFFER_PTR, (,), _)
+};
+
+static const struct mpsc_pbuf_buffer_config *const cpu_log_configs[] = {
+	LISTIFY(UTIL_DEC(CONFIG_MP_MAX_NUM_CPUS), LOG_CPU_CONFIG_PTR, (,), _)
+};
+#endif /* CONFIG_LOG_PER_CPU_BUFFERS */
+
 /* Check that default tag can fit in tag buffer. */
 COND_CODE_0(CONFIG_LOG_TAG_MAX_LEN, (),
 	(BUILD_ASSERT(sizeof(CONFIG_LOG_TAG_DEFAULT) <= CONFIG_LOG_TAG_MAX_LEN + 1,
@@ -652,6 +683,44 @@ void z_log_msg_init(void)
 	mpsc_pbuf_init(&log_buffer, &mpsc_config);
 	curr_log_buffer = &log_buffer;
 #endif
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	for (size_t i = 0; i < ARRAY_SIZE(cpu_log_buffers); i++) {
+		mpsc_pbuf_init(cpu_log_buffers[i], cpu_log_configs[i]);
+	}
+#endif
+}
+
+/* Buffer dedicated to the current CPU. The thread may migrate afterwards, which
+ * is harmless as any buffer accepts messages from any CPU.
+ */
+static struct mpsc_pbuf_buffer *local_buffer_get(void)
+{
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	uint32_t cpu = arch_curr_cpu()->id;
+
+	if (cpu > 0) {
+		return cpu_log_buffers[cpu - 1];
+	}
+#endif
+	return &log_buffer;
+}
+
+/* Buffer from which the message was allocated. */
+static struct mpsc_pbuf_buffer *msg_buffer_get(struct log_msg *msg)
+{
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	for (size_t i = 0; i < ARRAY_SIZE(cpu_log_buffers); i++) {
+		struct mpsc_pbuf_buffer *buffer = cpu_log_buffers[i];
+
+		if (((uint32_t *)msg >= buffer->buf) &&
+		    ((uint32_t *)msg < &buffer->buf[buffer->size])) {
+			return buffer;
+		}
+	}
+#else
+	ARG_UNUSED(msg);
+#endif
+	return &log_buffer;
 }
 
 static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
@@ -669,7 +738,7 @@ static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
 
 struct log_msg *z_log_msg_alloc(uint32_t wlen)
 {
-	return msg_alloc(&log_buffer, wlen);
+	return msg_alloc(local_buffer_get(), wlen);
 }
 
 static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
@@ -701,7 +770,7 @@ static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
 void z_log_msg_commit(struct log_msg *msg)
 {
 	msg->hdr.timestamp = timestamp_func();
-	msg_commit(&log_buffer, msg);
+	msg_commit(msg_buffer_get(msg), msg);
 }
 
 union log_msg_generic *z_log_msg_local_claim(void)
@@ -788,7 +857,8 @@ union log_msg_generic *z_log_msg_claim(k_timeout_t *backoff)
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
 	/* Use only one buffer if others are not registered. */
-	if (IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) && len > 1) {
+	if ((IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) || IS_ENABLED(CONFIG_LOG_PER_CPU_BUFFERS)) &&
+	    len > 1) {
 		return z_log_msg_claim_oldest(backoff);
 	}
 
@@ -823,7 +893,8 @@ bool z_log_msg_pending(void)
 
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
-	if (!IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) || (len == 1)) {
+	if ((!IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) && !IS_ENABLED(CONFIG_LOG_PER_CPU_BUFFERS)) ||
+	    (len == 1)) {
 		return msg_pending(&log_buffer);
 	}
 
@@ -83,6 +83,17 @@ int img_mgmt_read(int slot, unsigned int offset, void *dst, unsigned int num_byt
 int img_mgmt_write_image_data(unsigned int offset, const void *data, unsigned int num_bytes,
 			      bool last);
 
+/**
+ * @brief Verifies the image data of the completed upload against the SHA-256
+ * hash provided by the client.
+ *
+ * With CONFIG_IMG_STREAM_HASH the hash computed while the image was written is
+ * used, otherwise the image is read back from flash.
+ *
+ * @return 0 if the hash matches, negative errno code otherwise.
+ */
+int img_mgmt_check_image_data(void);
+
 /**
  * @brief Indicates the type of swap operation that will occur on the next
  * reboot, if any, between provided slot and it's pair.
@@ -131,6 +131,17 @@ LOG_MODULE_REGISTER(mcumgr_img_grp, CONFIG_MCUMGR_GRP_IMG_LOG_LEVEL);
 
 struct img_mgmt_state g_img_mgmt_state;
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW
+/* Upload chunk that arrived ahead of g_img_mgmt_state.off; a slot with len 0 is free */
+struct img_mgmt_window_slot {
+	size_t off;
+	size_t len;
+	uint8_t data[CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW_CHUNK_SIZE];
+};
+
+static struct img_mgmt_window_slot img_mgmt_window[CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW_SLOTS];
+#endif
+
 #ifdef CONFIG_MCUMGR_GRP_IMG_MUTEX
 static K_MUTEX_DEFINE(img_mgmt_mutex);
 #endif
@@ -414,6 +425,104 @@ img_mgmt_find_by_hash(uint8_t *find, struct image_version *ver)
 	return -1;
 }
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW
+/*
+ * Drops all buffered out-of-order upload chunks
+ */
+static void img_mgmt_window_reset(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(img_mgmt_window); i++) {
+		img_mgmt_window[i].len = 0;
+	}
+}
+
+/**
+ * Finds a slot to hold an upload chunk that arrived ahead of the next expected offset.
+ *
+ * @param req	The upload request, which the inspection did not accept for writing.
+ *
+ * @return The slot to store the chunk in; NULL if the chunk has to be dropped.
+ */
+static struct img_mgmt_window_slot *img_mgmt_window_slot_get(const struct img_mgmt_upload_req *req)
+{
+	struct img_mgmt_window_slot *free_slot = NULL;
+
+	if (req->off == SIZE_MAX || req->off <= g_img_mgmt_state.off ||
+	    req->img_data.len == 0 || req->img_data.len > sizeof(free_slot->data) ||
+	    req->off + req->img_data.len > g_img_mgmt_state.size) {
+		return NULL;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(img_mgmt_window); i++) {
+		if (img_mgmt_window[i].len == 0) {
+			if (free_slot == NULL) {
+				free_slot = &img_mgmt_window[i];
+			}
+		} else if (img_mgmt_window[i].off == req->off) {
+			/* Retransmission of a chunk that is already held */
+			return &img_mgmt_window[i];
+		}
+	}
+
+	if (free_slot == NULL) {
+		LOG_DBG("No window slot for chunk at offset %zu", req->off);
+	}
+
+	return free_slot;
+}
+
+/**
+ * Writes buffered chunks that continue the image at the next expected offset.
+ *
+ * @param last	Set to true when the last chunk of the image has been written.
+ *
+ * @return 0 on success; IMG_MGMT_ERR code on failure.
+ */
+static int img_mgmt_window_drain(bool *last)
+{
+	struct img_mgmt_window_slot *slot;
+	bool progress;
+	size_t len;
+	int rc;
+
+	do {
+		progress = false;
+
+		for (size_t i = 0; i < ARRAY_SIZE(img_mgmt_window); i++) {
+			slot = &img_mgmt_window[i];
+
+			if (slot->len == 0) {
+				continue;
+			}
+
+			if (slot->off < g_img_mgmt_state.off) {
+				/* Overtaken by a retransmission from the acknowledged offset */
+				slot->len = 0;
+				continue;
+			}
+
+			if (slot->off != g_img_mgmt_state.off) {
+				continue;
+			}
+
+			len = slot->len;
+			slot->len = 0;
+			*last = (slot->off + len == g_img_mgmt_state.size);
+
+			rc = img_mgmt_write_image_data(slot->off, slot->data, len, *last);
+			if (rc != 0) {
+				return rc;
+			}
+
+			g_img_mgmt_state.off += len;
+			progress = true;
+		}
+	} while (progress);
+
+	return 0;
+}
+#endif
+
 /*
  * Resets upload status to defaults (no upload in progress)
  */
@@ -426,6 +535,9 @@ static void img_mgmt_reset_upload(void)
 	img_mgmt_take_lock();
 	memset(&g_img_mgmt_state, 0, sizeof(g_img_mgmt_state));
 	g_img_mgmt_state.area_id = -1;
+#ifdef CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW
+	img_mgmt_window_reset();
+#endif
 	img_mgmt_release_lock();
 }
 
@@ -756,6 +868,7 @@ img_mgmt_upload(struct smp_streamer *ctxt)
 	struct img_mgmt_upload_action action;
 	bool last = false;
 	bool reset = false;
+	bool buffer = false;
 
 #ifdef CONFIG_IMG_ENABLE_IMAGE_CHECK
 	bool data_match = false;
@@ -820,7 +933,17 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 		goto end;
 	}
 
-	if (!action.proceed) {
+#ifdef CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW
+	/* A chunk ahead of the expected offset is held until the gap before it has been
+	 * filled, the offset in the response stays that of the next missing byte.
+	 */
+	if (!action.proceed && img_mgmt_window_slot_get(&req) != NULL) {
+		action.write_bytes = req.img_data.len;
+		buffer = true;
+	}
+#endif
+
+	if (!action.proceed && !buffer) {
 		/* Request specifies incorrect offset.  Respond with a success code and
 		 * the correct offset.
 		 */
@@ -851,6 +974,20 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 	}
 #endif
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW
+	if (buffer) {
+		struct img_mgmt_window_slot *slot = img_mgmt_window_slot_get(&req);
+
+		slot->off = req.off;
+		slot->len = req.img_data.len;
+		memcpy(slot->data, req.img_data.value, req.img_data.len);
+
+		rc = img_mgmt_upload_good_rsp(ctxt);
+		img_mgmt_release_lock();
+		return rc;
+	}
+#endif
+
 	/* Remember flash area ID and image size for subsequent upload requests. */
 	g_img_mgmt_state.area_id = action.area_id;
 	g_img_mgmt_state.size = action.size;
@@ -866,6 +1003,10 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 
 		g_img_mgmt_state.off = 0;
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW
+		img_mgmt_window_reset();
+#endif
+
 #if defined(CONFIG_MCUMGR_GRP_IMG_STATUS_HOOKS)
 		(void)mgmt_callback_notify(MGMT_EVT_OP_IMG_MGMT_DFU_STARTED, NULL, 0, &err_rc,
 					   &err_group);
@@ -942,7 +1083,13 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 						    last);
 		if (rc == 0) {
 			g_img_mgmt_state.off += action.write_bytes;
-		} else {
+
+#ifdef CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW
+			rc = img_mgmt_window_drain(&last);
+#endif
+		}
+
+		if (rc != 0) {
 			/* Write failed, currently not able to recover from this */
 #if defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 			cmd_status_arg.status = IMG_MGMT_ID_UPLOAD_STATUS_COMPLETE;
@@ -965,21 +1112,10 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 			reset = true;
 
 #ifdef CONFIG_IMG_ENABLE_IMAGE_CHECK
-			static struct flash_img_context ctx;
-
-			if (flash_img_init_id(&ctx, g_img_mgmt_state.area_id) == 0) {
-				struct flash_img_check fic = {
-					.match = g_img_mgmt_state.data_sha,
-					.clen = g_img_mgmt_state.size,
-				};
-
-				if (flash_img_check(&ctx, &fic, g_img_mgmt_state.area_id) == 0) {
-					data_match = true;
-				} else {
-					LOG_ERR("Uploaded image sha256 hash verification failed");
-				}
+			if (img_mgmt_check_image_data() == 0) {
+				data_match = true;
 			} else {
-				LOG_ERR("Uploaded image sha256 could not be checked");
+				LOG_ERR("Uploaded image sha256 hash verification failed");
 			}
 #endif
 
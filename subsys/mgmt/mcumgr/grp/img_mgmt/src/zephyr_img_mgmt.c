@@ -472,6 +472,23 @@ int img_mgmt_read(int slot, unsigned int offset, void *dst, unsigned int num_byt
 	return 0;
 }
 
+#if defined(CONFIG_IMG_STREAM_HASH)
+/* Result of checking the last uploaded image against the hash computed while
+ * it was written, -ENODATA when there is none.
+ */
+static int img_mgmt_stream_check_rc = -ENODATA;
+
+static void img_mgmt_stream_check(struct flash_img_context *ctx)
+{
+	struct flash_img_check fic = {
+		.match = g_img_mgmt_state.data_sha,
+		.clen = g_img_mgmt_state.size,
+	};
+
+	img_mgmt_stream_check_rc = flash_img_check_hash(ctx, &fic);
+}
+#endif
+
 #if defined(CONFIG_MCUMGR_GRP_IMG_USE_HEAP_FOR_FLASH_IMG_CONTEXT)
 int img_mgmt_write_image_data(unsigned int offset, const void *data, unsigned int num_bytes,
 			      bool last)
@@ -512,6 +529,12 @@ int img_mgmt_write_image_data(unsigned int offset, const void *data, unsigned in
 		goto out;
 	}
 
+#if defined(CONFIG_IMG_STREAM_HASH)
+	if (last) {
+		img_mgmt_stream_check(ctx);
+	}
+#endif
+
 out:
 	if (last || rc != MGMT_ERR_EOK) {
 		k_free(ctx);
@@ -536,10 +559,45 @@ int img_mgmt_write_image_data(unsigned int offset, const void *data, unsigned in
 		return IMG_MGMT_ERR_FLASH_WRITE_FAILED;
 	}
 
+#if defined(CONFIG_IMG_STREAM_HASH)
+	if (last) {
+		img_mgmt_stream_check(&ctx);
+	}
+#endif
+
 	return IMG_MGMT_ERR_OK;
 }
 #endif
 
+#if defined(CONFIG_IMG_ENABLE_IMAGE_CHECK)
+int img_mgmt_check_image_data(void)
+{
+	static struct flash_img_context ctx;
+	struct flash_img_check fic = {
+		.match = g_img_mgmt_state.data_sha,
+		.clen = g_img_mgmt_state.size,
+	};
+	int rc;
+
+#if defined(CONFIG_IMG_STREAM_HASH)
+	/* Reuse the hash computed while the image was written, if any */
+	rc = img_mgmt_stream_check_rc;
+	img_mgmt_stream_check_rc = -ENODATA;
+	if (rc != -ENODATA) {
+		return rc;
+	}
+#endif
+
+	rc = flash_img_init_id(&ctx, g_img_mgmt_state.area_id);
+	if (rc != 0) {
+		LOG_ERR("Uploaded image sha256 could not be checked");
+		return rc;
+	}
+
+	return flash_img_check(&ctx, &fic, g_img_mgmt_state.area_id);
+}
+#endif
+
 int img_mgmt_erase_image_data(unsigned int off, unsigned int num_bytes)
 {
 	const struct flash_area *fa;
@@ -328,23 +328,206 @@ int img_mgmt_client_upload_init(struct img_mgmt_client *client, size_t image_siz
 	return rc;
 }
 
+/* Encodes an upload request for length bytes of data at the given image offset */
+static struct net_buf *image_upload_chunk_alloc(size_t offset, const uint8_t *data, size_t length)
+{
+	struct net_buf *nb;
+	uint32_t map_count;
+	bool ok;
+	zcbor_state_t zse[CONFIG_MCUMGR_SMP_CBOR_MAX_DECODING_LEVELS + 2];
+
+	nb = smp_client_buf_allocation(active_client->smp_client, MGMT_GROUP_ID_IMAGE,
+				       IMG_MGMT_ID_UPLOAD, MGMT_OP_WRITE, SMP_MCUMGR_VERSION_1);
+	if (!nb) {
+		return NULL;
+	}
+
+	zcbor_new_encode_state(zse, ARRAY_SIZE(zse), nb->data + nb->len, net_buf_tailroom(nb), 0);
+	if (offset) {
+		map_count = 6;
+	} else if (active_client->upload.hash_initialized) {
+		map_count = 12;
+	} else {
+		map_count = 10;
+	}
+
+	/* Init map start and write image info, data and offset */
+	ok = zcbor_map_start_encode(zse, map_count) && zcbor_tstr_put_lit(zse, "image") &&
+	     zcbor_uint32_put(zse, active_client->upload.image_num) &&
+	     zcbor_tstr_put_lit(zse, "data") && zcbor_bstr_encode_ptr(zse, data, length) &&
+	     zcbor_tstr_put_lit(zse, "off") && zcbor_size_put(zse, offset);
+	/* Write Len and configured hash when offset is zero */
+	if (ok && !offset) {
+		ok = zcbor_tstr_put_lit(zse, "len") &&
+		     zcbor_size_put(zse, active_client->upload.image_size);
+		if (ok && active_client->upload.hash_initialized) {
+			ok = zcbor_tstr_put_lit(zse, "sha") &&
+			     zcbor_bstr_encode_ptr(zse, active_client->upload.sha256,
+						   IMG_MGMT_DATA_SHA_LEN);
+		}
+	}
+
+	if (ok) {
+		ok = zcbor_map_end_encode(zse, map_count);
+	}
+
+	if (!ok) {
+		LOG_ERR("Failed to encode Image Upload packet");
+		smp_packet_free(nb);
+		return NULL;
+	}
+
+	nb->len = zse->payload - nb->data;
+
+	return nb;
+}
+
+#if CONFIG_MCUMGR_GRP_IMG_CLIENT_UPLOAD_WINDOW > 1
+BUILD_ASSERT(CONFIG_SMP_CLIENT_CMD_MAX >= CONFIG_MCUMGR_GRP_IMG_CLIENT_UPLOAD_WINDOW,
+	     "SMP client can not track all upload requests of a window");
+
+static K_SEM_DEFINE(mcumgr_img_client_window_sem, 0, CONFIG_MCUMGR_GRP_IMG_CLIENT_UPLOAD_WINDOW);
+
+/*
+ * Response handler for windowed upload: the first failure is kept and the offset only moves
+ * forward, as responses to requests sent before a gap report an older cumulative offset.
+ */
+static int image_upload_window_res_fn(struct net_buf *nb, void *user_data)
+{
+	zcbor_state_t zsd[CONFIG_MCUMGR_SMP_CBOR_MAX_DECODING_LEVELS + 2];
+	size_t decoded;
+	size_t offset = SIZE_MAX;
+	int32_t res_rc = MGMT_ERR_EOK;
+	int rc;
+
+	struct zcbor_map_decode_key_val upload_res_decode[] = {
+		ZCBOR_MAP_DECODE_KEY_DECODER("off", zcbor_size_decode, &offset),
+		ZCBOR_MAP_DECODE_KEY_DECODER("rc", zcbor_int32_decode, &res_rc)};
+
+	if (!nb) {
+		rc = MGMT_ERR_ETIMEOUT;
+		goto end;
+	}
+
+	zcbor_new_decode_state(zsd, ARRAY_SIZE(zsd), nb->data, nb->len, 1, NULL, 0);
+
+	rc = zcbor_map_decode_bulk(zsd, upload_res_decode, ARRAY_SIZE(upload_res_decode), &decoded);
+	if (rc || offset == SIZE_MAX) {
+		rc = MGMT_ERR_EINVAL;
+		goto end;
+	}
+
+	rc = res_rc;
+	if (rc == MGMT_ERR_EOK && offset > image_upload_buf->image_upload_offset) {
+		image_upload_buf->image_upload_offset = offset;
+		active_client->upload.offset = offset;
+	}
+end:
+	if (image_upload_buf->status == MGMT_ERR_EOK) {
+		image_upload_buf->status = rc;
+	}
+
+	k_sem_give(user_data);
+	return rc;
+}
+
+/*
+ * Keeps up to CONFIG_MCUMGR_GRP_IMG_CLIENT_UPLOAD_WINDOW upload requests in flight. When all
+ * responses are in and the server has not acknowledged everything that was sent, sending
+ * restarts from the acknowledged offset, which also works with servers that drop chunks
+ * arriving out of order.
+ */
+static void image_upload_window(const uint8_t *data, size_t length, size_t max_data_length)
+{
+	struct net_buf *nb;
+	size_t base, send_offset, acked, write_length;
+	size_t resend_offset = SIZE_MAX;
+	int inflight = 0;
+	int window;
+	int rc;
+
+	base = active_client->upload.offset;
+	send_offset = base;
+	acked = base;
+
+	image_upload_buf->status = MGMT_ERR_EOK;
+	image_upload_buf->image_upload_offset = base;
+	k_sem_reset(&mcumgr_img_client_window_sem);
+
+	while (true) {
+		/* The first chunk starts the upload on the server, it goes out alone */
+		window = (acked == 0) ? 1 : CONFIG_MCUMGR_GRP_IMG_CLIENT_UPLOAD_WINDOW;
+
+		while (image_upload_buf->status == MGMT_ERR_EOK && inflight < window &&
+		       send_offset < base + length) {
+			write_length = MIN(base + length - send_offset, max_data_length);
+
+			nb = image_upload_chunk_alloc(send_offset, data + (send_offset - base),
+						      write_length);
+			if (!nb) {
+				image_upload_buf->status = MGMT_ERR_ENOMEM;
+				break;
+			}
+
+			rc = smp_client_send_cmd(active_client->smp_client, nb,
+						 image_upload_window_res_fn,
+						 &mcumgr_img_client_window_sem,
+						 CONFIG_MCUMGR_GRP_IMG_FLASH_OPERATION_TIMEOUT);
+			if (rc) {
+				LOG_ERR("Failed to send SMP Upload packet, err: %d", rc);
+				smp_packet_free(nb);
+				image_upload_buf->status = rc;
+				break;
+			}
+
+			send_offset += write_length;
+			inflight++;
+		}
+
+		if (inflight == 0) {
+			break;
+		}
+
+		/* Responses are always waited for, the handler uses the response buffer */
+		k_sem_take(&mcumgr_img_client_window_sem, K_FOREVER);
+		inflight--;
+		acked = image_upload_buf->image_upload_offset;
+
+		if (image_upload_buf->status != MGMT_ERR_EOK) {
+			LOG_ERR("Upload Fail: %d", image_upload_buf->status);
+		} else if (acked > send_offset) {
+			/* Offset further than sent which indicate upload session resume */
+			send_offset = base + length;
+		} else if (inflight == 0 && acked < send_offset) {
+			if (acked == resend_offset) {
+				/* No progress since the last resend, leave it to the caller */
+				LOG_WRN("Upload stalled at offset %zu", acked);
+				image_upload_buf->status = MGMT_ERR_EBUSY;
+			} else {
+				LOG_DBG("Resend from %zu, %zu sent", acked, send_offset);
+				resend_offset = acked;
+				send_offset = acked;
+			}
+		}
+	}
+}
+#endif
+
 int img_mgmt_client_upload(struct img_mgmt_client *client, const uint8_t *data, size_t length,
 			   struct mcumgr_image_upload *res_buf)
 {
+#if CONFIG_MCUMGR_GRP_IMG_CLIENT_UPLOAD_WINDOW == 1
 	struct net_buf *nb;
 	const uint8_t *write_ptr;
+	size_t write_length, offset_before_send, request_length, wrote_length;
+#endif
+	size_t max_data_length;
 	int rc;
-	uint32_t map_count;
-	bool ok;
-	size_t write_length, max_data_length, offset_before_send, request_length, wrote_length;
-	zcbor_state_t zse[CONFIG_MCUMGR_SMP_CBOR_MAX_DECODING_LEVELS + 2];
 
 	k_mutex_lock(&mcumgr_img_client_grp_mutex, K_FOREVER);
 	active_client = client;
 	image_upload_buf = res_buf;
 
-	request_length = length;
-	wrote_length = 0;
 	/* Calculate max data length based on
 	 * net_buf size - (SMP header + CBOR message_len + 16-bit CRC + 16-bit length)
 	 */
@@ -356,6 +539,12 @@ int img_mgmt_client_upload(struct img_mgmt_client *client, const uint8_t *data,
 			(max_data_length % CONFIG_MCUMGR_GRP_IMG_UPLOAD_DATA_ALIGNMENT_SIZE);
 	}
 
+#if CONFIG_MCUMGR_GRP_IMG_CLIENT_UPLOAD_WINDOW > 1
+	image_upload_window(data, length, max_data_length);
+#else
+	request_length = length;
+	wrote_length = 0;
+
 	while (request_length != wrote_length) {
 		write_ptr = data + wrote_length;
 		write_length = request_length - wrote_length;
@@ -363,55 +552,14 @@ int img_mgmt_client_upload(struct img_mgmt_client *client, const uint8_t *data,
 			write_length = max_data_length;
 		}
 
-		nb = smp_client_buf_allocation(active_client->smp_client, MGMT_GROUP_ID_IMAGE,
-					       IMG_MGMT_ID_UPLOAD, MGMT_OP_WRITE,
-					       SMP_MCUMGR_VERSION_1);
+		nb = image_upload_chunk_alloc(active_client->upload.offset, write_ptr,
+					      write_length);
 		if (!nb) {
 			image_upload_buf->status = MGMT_ERR_ENOMEM;
 			goto end;
 		}
 
-		zcbor_new_encode_state(zse, ARRAY_SIZE(zse), nb->data + nb->len,
-				       net_buf_tailroom(nb), 0);
-		if (active_client->upload.offset) {
-			map_count = 6;
-		} else if (active_client->upload.hash_initialized) {
-			map_count = 12;
-		} else {
-			map_count = 10;
-		}
-
-		/* Init map start and write image info, data and offset */
-		ok = zcbor_map_start_encode(zse, map_count) && zcbor_tstr_put_lit(zse, "image") &&
-		     zcbor_uint32_put(zse, active_client->upload.image_num) &&
-		     zcbor_tstr_put_lit(zse, "data") &&
-		     zcbor_bstr_encode_ptr(zse, write_ptr, write_length) &&
-		     zcbor_tstr_put_lit(zse, "off") &&
-		     zcbor_size_put(zse, active_client->upload.offset);
-		/* Write Len and configured hash when offset is zero */
-		if (ok && !active_client->upload.offset) {
-			ok = zcbor_tstr_put_lit(zse, "len") &&
-			     zcbor_size_put(zse, active_client->upload.image_size);
-			if (ok && active_client->upload.hash_initialized) {
-				ok = zcbor_tstr_put_lit(zse, "sha") &&
-				     zcbor_bstr_encode_ptr(zse, active_client->upload.sha256,
-							   IMG_MGMT_DATA_SHA_LEN);
-			}
-		}
-
-		if (ok) {
-			ok = zcbor_map_end_encode(zse, map_count);
-		}
-
-		if (!ok) {
-			LOG_ERR("Failed to encode Image Upload packet");
-			smp_packet_free(nb);
-			image_upload_buf->status = MGMT_ERR_ENOMEM;
-			goto end;
-		}
-
 		offset_before_send = active_client->upload.offset;
-		nb->len = zse->payload - nb->data;
 		k_sem_reset(&mcumgr_img_client_grp_sem);
 
 		image_upload_buf->status = MGMT_ERR_EINVAL;
@@ -441,6 +589,7 @@ int img_mgmt_client_upload(struct img_mgmt_client *client, const uint8_t *data,
 		wrote_length += write_length;
 	}
 end:
+#endif
 	rc = image_upload_buf->status;
 	active_client = NULL;
 	image_upload_buf = NULL;
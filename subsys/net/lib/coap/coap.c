@@ -13,6 +13,7 @@ LOG_MODULE_REGISTER(net_coap, CONFIG_COAP_LOG_LEVEL);
 #include <stdbool.h>
 #include <errno.h>
 #include <zephyr/random/random.h>
+#include <zephyr/sys/__assert.h>
 #include <zephyr/sys/atomic.h>
 #include <zephyr/sys/util.h>
 
@@ -1091,13 +1092,16 @@ bool coap_uri_path_match(const char * const *path,
 {
 	uint8_t i;
 	uint8_t j = 0U;
+	size_t seg_len;
 
 	for (i = 0U; i < opt_num && path[j]; i++) {
 		if (options[i].delta != COAP_OPTION_URI_PATH) {
 			continue;
 		}
 
-		if (IS_ENABLED(CONFIG_COAP_URI_WILDCARD) && strlen(path[j]) == 1) {
+		seg_len = strlen(path[j]);
+
+		if (IS_ENABLED(CONFIG_COAP_URI_WILDCARD) && seg_len == 1) {
 			if (*path[j] == '+') {
 				/* Single-level wildcard */
 				j++;
@@ -1108,7 +1112,7 @@ bool coap_uri_path_match(const char * const *path,
 			}
 		}
 
-		if (options[i].len != strlen(path[j])) {
+		if (options[i].len != seg_len) {
 			return false;
 		}
 
@@ -1797,6 +1801,200 @@ size_t coap_pendings_count(struct coap_pending *pendings, size_t len)
 	return c;
 }
 
+static inline int64_t pending_expiry(const struct coap_pending *pending)
+{
+	return pending->t0 + pending->timeout;
+}
+
+static void pending_index_insert(uint8_t *index, size_t count, size_t pos, uint8_t entry)
+{
+	memmove(&index[pos + 1], &index[pos], count - pos);
+	index[pos] = entry;
+}
+
+static bool pending_index_remove(uint8_t *index, size_t count, uint8_t entry)
+{
+	for (size_t i = 0; i < count; i++) {
+		if (index[i] == entry) {
+			memmove(&index[i], &index[i + 1], count - i - 1);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* First position of the ID index whose message ID is not lower than id */
+static size_t pending_id_lower_bound(const struct coap_pending_queue *queue, uint16_t id)
+{
+	size_t low = 0;
+	size_t high = queue->count;
+
+	while (low < high) {
+		size_t mid = low + (high - low) / 2;
+
+		if (queue->pendings[queue->by_id[mid]].id < id) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+
+	return low;
+}
+
+/* First position of the expiry index in [low, high) that expires after expiry */
+static size_t pending_expiry_upper_bound(const struct coap_pending_queue *queue,
+					 size_t low, size_t high, int64_t expiry)
+{
+
+	while (low < high) {
+		size_t mid = low + (high - low) / 2;
+
+		if (pending_expiry(&queue->pendings[queue->by_expiry[mid]]) <= expiry) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+
+	return low;
+}
+
+void coap_pending_queue_init(struct coap_pending_queue *queue,
+			     struct coap_pending *pendings,
+			     uint8_t *by_id, uint8_t *by_expiry, size_t len)
+{
+	__ASSERT_NO_MSG(len <= UINT8_MAX);
+
+	queue->pendings = pendings;
+	queue->by_id = by_id;
+	queue->by_expiry = by_expiry;
+	queue->size = len;
+	queue->count = 0U;
+}
+
+int coap_pending_queue_add(struct coap_pending_queue *queue,
+			   struct coap_pending *pending)
+{
+	size_t entry = pending - queue->pendings;
+	size_t pos;
+
+	if (pending < queue->pendings || entry >= queue->size || pending->timeout == 0U) {
+		return -EINVAL;
+	}
+
+	if (queue->count >= queue->size) {
+		return -ENOMEM;
+	}
+
+	pos = pending_id_lower_bound(queue, pending->id);
+	pending_index_insert(queue->by_id, queue->count, pos, entry);
+
+	pos = pending_expiry_upper_bound(queue, 0, queue->count, pending_expiry(pending));
+	pending_index_insert(queue->by_expiry, queue->count, pos, entry);
+
+	queue->count++;
+
+	return 0;
+}
+
+void coap_pending_queue_remove(struct coap_pending_queue *queue,
+			       struct coap_pending *pending)
+{
+	size_t entry = pending - queue->pendings;
+
+	if (pending < queue->pendings || entry >= queue->size) {
+		return;
+	}
+
+	if (pending_index_remove(queue->by_id, queue->count, entry)) {
+		(void)pending_index_remove(queue->by_expiry, queue->count, entry);
+		queue->count--;
+	}
+}
+
+struct coap_pending *coap_pending_queue_received(
+	const struct coap_pending_queue *queue,
+	const struct coap_packet *response)
+{
+	uint16_t resp_id = coap_header_get_id(response);
+	size_t pos = pending_id_lower_bound(queue, resp_id);
+	struct coap_pending *p;
+
+	if (pos >= queue->count) {
+		return NULL;
+	}
+
+	p = &queue->pendings[queue->by_id[pos]];
+	if (p->id != resp_id) {
+		return NULL;
+	}
+
+	return p;
+}
+
+struct coap_pending *coap_pending_queue_next_to_expire(
+	const struct coap_pending_queue *queue)
+{
+	if (queue->count == 0U) {
+		return NULL;
+	}
+
+	return &queue->pendings[queue->by_expiry[0]];
+}
+
+size_t coap_pending_queue_expire(struct coap_pending_queue *queue, int64_t now,
+				 coap_pending_expired_t cb, void *user_data)
+{
+	size_t expired = 0;
+	size_t kept = 0;
+	size_t count;
+
+	/* The expiry index is sorted, so the expired entries are at its head */
+	while (expired < queue->count &&
+	       pending_expiry(&queue->pendings[queue->by_expiry[expired]]) <= now) {
+		expired++;
+	}
+
+	for (size_t i = 0; i < expired; i++) {
+		uint8_t entry = queue->by_expiry[i];
+		struct coap_pending *p = &queue->pendings[entry];
+
+		if (coap_pending_cycle(p)) {
+			queue->by_expiry[kept++] = entry;
+			cb(p, true, user_data);
+		} else {
+			(void)pending_index_remove(queue->by_id, queue->count - (i - kept), entry);
+			cb(p, false, user_data);
+		}
+	}
+
+	if (expired == 0) {
+		return 0;
+	}
+
+	/* Drop the removed entries, then move each requeued entry, last first,
+	 * into the sorted part of the index that follows it.
+	 */
+	memmove(&queue->by_expiry[kept], &queue->by_expiry[expired], queue->count - expired);
+	count = queue->count - (expired - kept);
+
+	for (size_t i = kept; i > 0; i--) {
+		uint8_t entry = queue->by_expiry[i - 1];
+		size_t pos;
+
+		memmove(&queue->by_expiry[i - 1], &queue->by_expiry[i], count - i);
+		pos = pending_expiry_upper_bound(queue, i - 1, count - 1,
+						 pending_expiry(&queue->pendings[entry]));
+		pending_index_insert(queue->by_expiry, count - 1, pos, entry);
+	}
+
+	queue->count = count;
+
+	return expired;
+}
+
 /* Reordering according to RFC7641 section 3.4 but without timestamp comparison */
 IF_DISABLED(CONFIG_ZTEST, (static inline))
 bool coap_age_is_newer(int v1, int v2)
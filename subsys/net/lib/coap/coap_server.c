@@ -37,6 +37,7 @@ LOG_MODULE_DECLARE(net_coap, CONFIG_COAP_LOG_LEVEL);
 #define MAX_POLL_FD    CONFIG_ZVFS_POLL_MAX
 
 BUILD_ASSERT(CONFIG_ZVFS_POLL_MAX > 0, "CONFIG_ZVFS_POLL_MAX can't be 0");
+BUILD_ASSERT(MAX_PENDINGS <= UINT8_MAX, "CONFIG_COAP_SERVICE_PENDING_MESSAGES is too large");
 
 static K_MUTEX_DEFINE(lock);
 static int control_sock;
@@ -210,7 +211,7 @@ static int coap_server_process(int sock_fd)
 		goto unlock;
 	}
 
-	pending = coap_pending_received(&request, service->data->pending, MAX_PENDINGS);
+	pending = coap_pending_queue_received(&service->data->pending_queue, &request);
 	if (pending) {
 		uint8_t token[COAP_TOKEN_MAX_LEN];
 		uint8_t tkl;
@@ -221,6 +222,7 @@ static int coap_server_process(int sock_fd)
 			coap_service_remove_observer(service, NULL, &client_addr, token, tkl);
 			__fallthrough;
 		case COAP_TYPE_ACK:
+			coap_pending_queue_remove(&service->data->pending_queue, pending);
 			coap_server_free(pending->data);
 			coap_pending_clear(pending);
 			break;
@@ -293,12 +295,32 @@ unlock:
 	return ret;
 }
 
+static void coap_server_pending_expired(struct coap_pending *pending, bool retransmit,
+					void *user_data)
+{
+	const struct coap_service *service = user_data;
+	int ret;
+
+	if (retransmit) {
+		ret = zsock_sendto(service->data->sock_fd, pending->data, pending->len, 0,
+				   &pending->addr, ADDRLEN(&pending->addr));
+		if (ret < 0) {
+			LOG_ERR("Failed to send pending retransmission for %s (%d)",
+				service->name, ret);
+		}
+		__ASSERT_NO_MSG(ret == pending->len);
+	} else {
+		LOG_WRN("Packet retransmission failed for %s", service->name);
+
+		coap_service_remove_observer(service, NULL, &pending->addr, NULL, 0U);
+		coap_server_free(pending->data);
+		coap_pending_clear(pending);
+	}
+}
+
 static void coap_server_retransmit(void)
 {
-	struct coap_pending *pending;
-	int64_t remaining;
 	int64_t now = k_uptime_get();
-	int ret;
 
 	(void)k_mutex_lock(&lock, K_FOREVER);
 
@@ -307,33 +329,9 @@ static void coap_server_retransmit(void)
 			continue;
 		}
 
-		pending = coap_pending_next_to_expire(service->data->pending, MAX_PENDINGS);
-		if (pending == NULL) {
-			/* No work to be done */
-			continue;
-		}
-
-		/* Check if the pending request has expired */
-		remaining = pending->t0 + pending->timeout - now;
-		if (remaining > 0) {
-			continue;
-		}
-
-		if (coap_pending_cycle(pending)) {
-			ret = zsock_sendto(service->data->sock_fd, pending->data, pending->len, 0,
-					   &pending->addr, ADDRLEN(&pending->addr));
-			if (ret < 0) {
-				LOG_ERR("Failed to send pending retransmission for %s (%d)",
-					service->name, ret);
-			}
-			__ASSERT_NO_MSG(ret == pending->len);
-		} else {
-			LOG_WRN("Packet retransmission failed for %s", service->name);
-
-			coap_service_remove_observer(service, NULL, &pending->addr, NULL, 0U);
-			coap_server_free(pending->data);
-			coap_pending_clear(pending);
-		}
+		/* Handle every expired pending request in a single pass */
+		(void)coap_pending_queue_expire(&service->data->pending_queue, now,
+						coap_server_pending_expired, (void *)service);
 	}
 
 	(void)k_mutex_unlock(&lock);
@@ -351,7 +349,7 @@ static int coap_server_poll_timeout(void)
 			continue;
 		}
 
-		pending = coap_pending_next_to_expire(svc->data->pending, MAX_PENDINGS);
+		pending = coap_pending_queue_next_to_expire(&svc->data->pending_queue);
 		if (pending == NULL) {
 			continue;
 		}
@@ -635,6 +633,14 @@ int coap_service_send(const struct coap_service *service, const struct coap_pack
 
 		coap_pending_cycle(pending);
 
+		ret = coap_pending_queue_add(&service->data->pending_queue, pending);
+		if (ret < 0) {
+			LOG_WRN("Failed to queue pending message for %s (%d)", service->name, ret);
+			coap_server_free(pending->data);
+			coap_pending_clear(pending);
+			goto send;
+		}
+
 		/* Trigger event in receive loop to schedule retransmit */
 		coap_server_update_services();
 	}
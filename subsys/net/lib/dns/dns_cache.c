@@ -6,12 +6,31 @@
 
 #include <zephyr/net/dns_resolve.h>
 #include <zephyr/net/net_ip.h>
+#include <zephyr/sys/crc.h>
 #include "dns_cache.h"
 
 LOG_MODULE_REGISTER(net_dns_cache, CONFIG_DNS_RESOLVER_LOG_LEVEL);
 
 static void dns_cache_clean(struct dns_cache const *cache);
 
+static uint16_t dns_cache_hash(char const *query)
+{
+	return crc16_ansi(query, strlen(query));
+}
+
+static int dns_cache_type_to_family(enum dns_query_type type, net_sa_family_t *family)
+{
+	if (type == DNS_QUERY_TYPE_A) {
+		*family = NET_AF_INET;
+	} else if (type == DNS_QUERY_TYPE_AAAA) {
+		*family = NET_AF_INET6;
+	} else {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
 int dns_cache_flush(struct dns_cache *cache)
 {
 	k_mutex_lock(cache->lock, K_FOREVER);
@@ -23,13 +42,38 @@ int dns_cache_flush(struct dns_cache *cache)
 	return 0;
 }
 
-int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinfo const *addrinfo,
-		  uint32_t ttl)
+/* Needs to be called when lock is already acquired */
+static struct dns_cache_entry *dns_cache_entry_alloc(struct dns_cache *cache)
 {
 	k_timepoint_t closest_to_expiry = sys_timepoint_calc(K_FOREVER);
 	size_t index_to_replace = 0;
 	bool found_empty = false;
 
+	dns_cache_clean(cache);
+
+	for (size_t i = 0; i < cache->size; i++) {
+		if (!cache->entries[i].in_use) {
+			index_to_replace = i;
+			found_empty = true;
+			break;
+		} else if (sys_timepoint_cmp(closest_to_expiry, cache->entries[i].expiry) > 0) {
+			index_to_replace = i;
+			closest_to_expiry = cache->entries[i].expiry;
+		}
+	}
+
+	if (!found_empty) {
+		NET_DBG("Overwrite \"%s\"", cache->entries[index_to_replace].query);
+	}
+
+	return &cache->entries[index_to_replace];
+}
+
+int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinfo const *addrinfo,
+		  uint32_t ttl)
+{
+	struct dns_cache_entry *entry;
+
 	if (cache == NULL || query == NULL || addrinfo == NULL || ttl == 0) {
 		return -EINVAL;
 	}
@@ -45,28 +89,54 @@ int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinf
 
 	NET_DBG("Add \"%s\" with TTL %" PRIu32, query, ttl);
 
-	dns_cache_clean(cache);
+	entry = dns_cache_entry_alloc(cache);
 
-	for (size_t i = 0; i < cache->size; i++) {
-		if (!cache->entries[i].in_use) {
-			index_to_replace = i;
-			found_empty = true;
-			break;
-		} else if (sys_timepoint_cmp(closest_to_expiry, cache->entries[i].expiry) > 0) {
-			index_to_replace = i;
-			closest_to_expiry = cache->entries[i].expiry;
-		}
+	strncpy(entry->query, query, CONFIG_DNS_RESOLVER_MAX_QUERY_LEN - 1);
+	entry->query_hash = dns_cache_hash(query);
+	entry->data = *addrinfo;
+	entry->expiry = sys_timepoint_calc(K_SECONDS(ttl));
+	entry->negative = false;
+	entry->in_use = true;
+
+	k_mutex_unlock(cache->lock);
+
+	return 0;
+}
+
+int dns_cache_add_negative(struct dns_cache *cache, char const *query, enum dns_query_type type,
+			   uint32_t ttl)
+{
+	struct dns_cache_entry *entry;
+	net_sa_family_t family;
+
+	if (cache == NULL || query == NULL || ttl == 0) {
+		return -EINVAL;
 	}
 
-	if (!found_empty) {
-		NET_DBG("Overwrite \"%s\"", cache->entries[index_to_replace].query);
+	if (dns_cache_type_to_family(type, &family) < 0) {
+		return -EINVAL;
+	}
+
+	if (strlen(query) >= CONFIG_DNS_RESOLVER_MAX_QUERY_LEN) {
+		NET_WARN("Query string to big to be processed %u >= "
+			 "CONFIG_DNS_RESOLVER_MAX_QUERY_LEN",
+			 strlen(query));
+		return -EINVAL;
 	}
 
-	strncpy(cache->entries[index_to_replace].query, query,
-		CONFIG_DNS_RESOLVER_MAX_QUERY_LEN - 1);
-	cache->entries[index_to_replace].data = *addrinfo;
-	cache->entries[index_to_replace].expiry = sys_timepoint_calc(K_SECONDS(ttl));
-	cache->entries[index_to_replace].in_use = true;
+	k_mutex_lock(cache->lock, K_FOREVER);
+
+	NET_DBG("Add negative \"%s\" with TTL %" PRIu32, query, ttl);
+
+	entry = dns_cache_entry_alloc(cache);
+
+	strncpy(entry->query, query, CONFIG_DNS_RESOLVER_MAX_QUERY_LEN - 1);
+	entry->query_hash = dns_cache_hash(query);
+	memset(&entry->data, 0, sizeof(entry->data));
+	entry->data.ai_family = family;
+	entry->expiry = sys_timepoint_calc(K_SECONDS(ttl));
+	entry->negative = true;
+	entry->in_use = true;
 
 	k_mutex_unlock(cache->lock);
 
@@ -75,6 +145,8 @@ int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinf
 
 int dns_cache_remove(struct dns_cache *cache, char const *query)
 {
+	uint16_t hash;
+
 	if (cache == NULL || query == NULL) {
 		return -EINVAL;
 	}
@@ -87,12 +159,15 @@ int dns_cache_remove(struct dns_cache *cache, char const *query)
 		return -EINVAL;
 	}
 
+	hash = dns_cache_hash(query);
+
 	k_mutex_lock(cache->lock, K_FOREVER);
 
 	dns_cache_clean(cache);
 
 	for (size_t i = 0; i < cache->size; i++) {
-		if (cache->entries[i].in_use && strcmp(cache->entries[i].query, query) == 0) {
+		if (cache->entries[i].in_use && cache->entries[i].query_hash == hash &&
+		    strcmp(cache->entries[i].query, query) == 0) {
 			cache->entries[i].in_use = false;
 		}
 	}
@@ -106,17 +181,15 @@ int dns_cache_find(struct dns_cache const *cache, const char *query, enum dns_qu
 		   struct dns_addrinfo *addrinfo, size_t addrinfo_array_len)
 {
 	size_t found = 0;
+	bool negative = false;
 	net_sa_family_t family;
+	uint16_t hash;
 
 	NET_DBG("Find \"%s\"", query);
 	if (cache == NULL || query == NULL || addrinfo == NULL || addrinfo_array_len <= 0) {
 		return -EINVAL;
 	}
-	if (type == DNS_QUERY_TYPE_A) {
-		family = NET_AF_INET;
-	} else if (type == DNS_QUERY_TYPE_AAAA) {
-		family = NET_AF_INET6;
-	} else {
+	if (dns_cache_type_to_family(type, &family) < 0) {
 		return -EINVAL;
 	}
 	if (strlen(query) >= CONFIG_DNS_RESOLVER_MAX_QUERY_LEN) {
@@ -126,6 +199,8 @@ int dns_cache_find(struct dns_cache const *cache, const char *query, enum dns_qu
 		return -EINVAL;
 	}
 
+	hash = dns_cache_hash(query);
+
 	k_mutex_lock(cache->lock, K_FOREVER);
 
 	dns_cache_clean(cache);
@@ -134,12 +209,19 @@ int dns_cache_find(struct dns_cache const *cache, const char *query, enum dns_qu
 		if (!cache->entries[i].in_use) {
 			continue;
 		}
+		if (cache->entries[i].query_hash != hash) {
+			continue;
+		}
 		if (strcmp(cache->entries[i].query, query) != 0) {
 			continue;
 		}
 		if (cache->entries[i].data.ai_family != family) {
 			continue;
 		}
+		if (cache->entries[i].negative) {
+			negative = true;
+			continue;
+		}
 		if (found >= addrinfo_array_len) {
 			NET_WARN("Found \"%s\" but not enough space in provided buffer.", query);
 			found++;
@@ -156,6 +238,11 @@ int dns_cache_find(struct dns_cache const *cache, const char *query, enum dns_qu
 		return -ENOSR;
 	}
 
+	if (found == 0 && negative) {
+		NET_DBG("Found negative entry for \"%s\"", query);
+		return -ENOENT;
+	}
+
 	if (found == 0) {
 		NET_DBG("Could not find \"%s\"", query);
 	}
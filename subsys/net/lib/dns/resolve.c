@@ -1261,6 +1261,44 @@ static int dns_validate_record(struct dns_resolve_context *ctx, struct dns_msg_t
 	return 0;
 }
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE) && CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL > 0
+/* The name does not exist (NXDOMAIN), remember it so that the next queries
+ * for it are answered from the cache instead of being sent to the server.
+ * The query fails with DNS_EAI_FAIL, as it does without negative caching.
+ */
+static int dns_validate_name_error(struct dns_resolve_context *ctx,
+				   struct dns_msg_t *dns_msg,
+				   uint16_t *dns_id,
+				   int *query_idx,
+				   uint16_t *query_hash)
+{
+	int ret;
+
+	if (dns_header_qdcount(dns_msg->msg) < 1) {
+		return DNS_EAI_FAIL;
+	}
+
+	ret = dns_unpack_response_query(dns_msg);
+	if (ret < 0) {
+		return DNS_EAI_FAIL;
+	}
+
+	if (*query_idx < 0) {
+		ret = update_query_idx(ctx, dns_msg, dns_id, query_idx, query_hash);
+		if (ret < 0) {
+			errno = -ret;
+			return DNS_EAI_SYSTEM;
+		}
+	}
+
+	(void)dns_cache_add_negative(&dns_cache, ctx->queries[*query_idx].query,
+				     ctx->queries[*query_idx].query_type,
+				     CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL);
+
+	return DNS_EAI_FAIL;
+}
+#endif /* CONFIG_DNS_RESOLVER_CACHE */
+
 /* Unit test needs to be able to call this function */
 #if !defined(CONFIG_NET_TEST)
 static
@@ -1312,6 +1350,13 @@ int dns_validate_msg(struct dns_resolve_context *ctx,
 		goto quit;
 	}
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE) && CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL > 0
+	if (ret == DNS_HEADER_NAMEERROR && *dns_id > 0) {
+		ret = dns_validate_name_error(ctx, dns_msg, dns_id, query_idx, query_hash);
+		goto quit;
+	}
+#endif /* CONFIG_DNS_RESOLVER_CACHE */
+
 	if (dns_header_qdcount(dns_msg->msg) < 1) {
 		/* For mDNS (when dns_id == 0) the query count is 0 */
 		if (*dns_id > 0) {
@@ -1921,6 +1966,13 @@ try_resolve:
 
 			return 0;
 		}
+
+		if (ret == -ENOENT) {
+			/* The name is known not to exist, fail as the server did */
+			cb(DNS_EAI_FAIL, NULL, user_data);
+
+			return 0;
+		}
 	}
 #else
 	ARG_UNUSED(use_cache);
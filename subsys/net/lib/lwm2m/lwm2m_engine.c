@@ -591,6 +591,41 @@ void lwm2m_socket_del(struct lwm2m_ctx *ctx)
 	lwm2m_engine_wake_up();
 }
 
+#if CONFIG_LWM2M_NOTIFY_COALESCE_WINDOW > 0
+/* When a notification is due, pull forward the periodic (pmax) notifications
+ * expiring within the coalescing window, so they are sent in the same burst
+ * instead of waking the radio up again shortly after.
+ */
+static void coalesce_notifications(struct lwm2m_ctx *ctx, const int64_t timestamp)
+{
+	struct observe_node *obs;
+	bool due = false;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&ctx->observer, obs, node) {
+		if (obs->event_timestamp && obs->event_timestamp <= timestamp) {
+			due = true;
+			break;
+		}
+	}
+
+	if (!due) {
+		return;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&ctx->observer, obs, node) {
+		/* Notifications triggered by a resource update must honor pmin */
+		if (!obs->event_timestamp || obs->resource_update || obs->active_notify != NULL) {
+			continue;
+		}
+
+		if (obs->event_timestamp > timestamp &&
+		    obs->event_timestamp <= timestamp + CONFIG_LWM2M_NOTIFY_COALESCE_WINDOW) {
+			obs->event_timestamp = timestamp;
+		}
+	}
+}
+#endif
+
 /* Generate notify messages. Return timestamp of next Notify event */
 static int64_t check_notifications(struct lwm2m_ctx *ctx, const int64_t timestamp)
 {
@@ -599,6 +634,9 @@ static int64_t check_notifications(struct lwm2m_ctx *ctx, const int64_t timestam
 	int64_t next = INT64_MAX;
 
 	lwm2m_registry_lock();
+#if CONFIG_LWM2M_NOTIFY_COALESCE_WINDOW > 0
+	coalesce_notifications(ctx, timestamp);
+#endif
 	SYS_SLIST_FOR_EACH_CONTAINER(&ctx->observer, obs, node) {
 		if (!obs->event_timestamp) {
 			continue;
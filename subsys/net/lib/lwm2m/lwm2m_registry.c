@@ -94,6 +94,85 @@ sys_slist_t *lwm2m_engine_obj_list(void) { return &engine_obj_list; }
 
 sys_slist_t *lwm2m_engine_obj_inst_list(void) { return &engine_obj_inst_list; }
 
+#if defined(CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX)
+/* Object instances sorted by object ID, then by object instance ID */
+static struct lwm2m_engine_obj_inst *obj_inst_index[CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX_SIZE];
+static size_t obj_inst_index_count;
+/* Set once the index could not hold every instance, lookups then walk the list */
+static bool obj_inst_index_overflow;
+
+static int obj_inst_index_cmp(const struct lwm2m_engine_obj_inst *obj_inst, int obj_id,
+			      int obj_inst_id)
+{
+	if (obj_inst->obj->obj_id != obj_id) {
+		return obj_inst->obj->obj_id < obj_id ? -1 : 1;
+	}
+
+	if (obj_inst->obj_inst_id != obj_inst_id) {
+		return obj_inst->obj_inst_id < obj_inst_id ? -1 : 1;
+	}
+
+	return 0;
+}
+
+/* Returns the position of the first entry not lower than (obj_id, obj_inst_id) */
+static size_t obj_inst_index_lower_bound(int obj_id, int obj_inst_id)
+{
+	size_t low = 0;
+	size_t high = obj_inst_index_count;
+
+	while (low < high) {
+		size_t mid = low + (high - low) / 2;
+
+		if (obj_inst_index_cmp(obj_inst_index[mid], obj_id, obj_inst_id) < 0) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+
+	return low;
+}
+
+static void obj_inst_index_add(struct lwm2m_engine_obj_inst *obj_inst)
+{
+	size_t pos;
+
+	if (obj_inst_index_overflow) {
+		return;
+	}
+
+	if (obj_inst_index_count == ARRAY_SIZE(obj_inst_index)) {
+		LOG_WRN("Object instance index full, increase "
+			"CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX_SIZE");
+		obj_inst_index_overflow = true;
+		return;
+	}
+
+	pos = obj_inst_index_lower_bound(obj_inst->obj->obj_id, obj_inst->obj_inst_id);
+	memmove(&obj_inst_index[pos + 1], &obj_inst_index[pos],
+		(obj_inst_index_count - pos) * sizeof(obj_inst_index[0]));
+	obj_inst_index[pos] = obj_inst;
+	obj_inst_index_count++;
+}
+
+static void obj_inst_index_remove(struct lwm2m_engine_obj_inst *obj_inst)
+{
+	size_t pos;
+
+	pos = obj_inst_index_lower_bound(obj_inst->obj->obj_id, obj_inst->obj_inst_id);
+	if (pos < obj_inst_index_count && obj_inst_index[pos] == obj_inst) {
+		obj_inst_index_count--;
+		memmove(&obj_inst_index[pos], &obj_inst_index[pos + 1],
+			(obj_inst_index_count - pos) * sizeof(obj_inst_index[0]));
+	}
+
+	if (obj_inst_index_overflow && sys_slist_is_empty(&engine_obj_inst_list)) {
+		obj_inst_index_overflow = false;
+	}
+}
+#endif /* CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX */
+
 #if defined(CONFIG_LWM2M_RESOURCE_DATA_CACHE_SUPPORT)
 static void lwm2m_engine_cache_write(const struct lwm2m_engine_obj_field *obj_field,
 				     const struct lwm2m_obj_path *path, const void *value,
@@ -145,6 +224,11 @@ struct lwm2m_engine_obj_field *lwm2m_get_engine_obj_field(struct lwm2m_engine_ob
 	int i;
 
 	if (obj && obj->fields && obj->field_count > 0) {
+		/* Most objects declare their fields in resource ID order, starting at 0 */
+		if (res_id >= 0 && res_id < obj->field_count && obj->fields[res_id].res_id == res_id) {
+			return &obj->fields[res_id];
+		}
+
 		for (i = 0; i < obj->field_count; i++) {
 			if (obj->fields[i].res_id == res_id) {
 				return &obj->fields[i];
@@ -176,6 +260,9 @@ static void engine_register_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
 #endif /* CONFIG_LWM2M_RD_CLIENT_SUPPORT_BOOTSTRAP */
 #endif /* CONFIG_LWM2M_ACCESS_CONTROL_ENABLE */
 	sys_slist_append(&engine_obj_inst_list, &obj_inst->node);
+#if defined(CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX)
+	obj_inst_index_add(obj_inst);
+#endif
 }
 
 static void engine_unregister_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
@@ -185,12 +272,28 @@ static void engine_unregister_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
 #endif
 	engine_remove_observer_by_id(obj_inst->obj->obj_id, obj_inst->obj_inst_id);
 	sys_slist_find_and_remove(&engine_obj_inst_list, &obj_inst->node);
+#if defined(CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX)
+	obj_inst_index_remove(obj_inst);
+#endif
 }
 
 struct lwm2m_engine_obj_inst *get_engine_obj_inst(int obj_id, int obj_inst_id)
 {
 	struct lwm2m_engine_obj_inst *obj_inst;
 
+#if defined(CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX)
+	if (!obj_inst_index_overflow) {
+		size_t pos = obj_inst_index_lower_bound(obj_id, obj_inst_id);
+
+		if (pos < obj_inst_index_count &&
+		    obj_inst_index_cmp(obj_inst_index[pos], obj_id, obj_inst_id) == 0) {
+			return obj_inst_index[pos];
+		}
+
+		return NULL;
+	}
+#endif
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&engine_obj_inst_list, obj_inst, node) {
 		if (obj_inst->obj->obj_id == obj_id && obj_inst->obj_inst_id == obj_inst_id) {
 			return obj_inst;
@@ -204,6 +307,18 @@ struct lwm2m_engine_obj_inst *next_engine_obj_inst(int obj_id, int obj_inst_id)
 {
 	struct lwm2m_engine_obj_inst *obj_inst, *next = NULL;
 
+#if defined(CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX)
+	if (!obj_inst_index_overflow) {
+		size_t pos = obj_inst_index_lower_bound(obj_id, obj_inst_id + 1);
+
+		if (pos < obj_inst_index_count && obj_inst_index[pos]->obj->obj_id == obj_id) {
+			return obj_inst_index[pos];
+		}
+
+		return NULL;
+	}
+#endif
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&engine_obj_inst_list, obj_inst, node) {
 		if (obj_inst->obj->obj_id == obj_id && obj_inst->obj_inst_id > obj_inst_id &&
 		    (!next || next->obj_inst_id > obj_inst->obj_inst_id)) {
@@ -392,10 +507,16 @@ int path_to_objs(const struct lwm2m_obj_path *path, struct lwm2m_engine_obj_inst
 		return -ENOENT;
 	}
 
-	for (i = 0; i < oi->resource_count; i++) {
-		if (oi->resources[i].res_id == path->res_id) {
-			r = &oi->resources[i];
-			break;
+	/* Resources are usually laid out in the same order as the object fields */
+	i = of - oi->obj->fields;
+	if (i < oi->resource_count && oi->resources[i].res_id == path->res_id) {
+		r = &oi->resources[i];
+	} else {
+		for (i = 0; i < oi->resource_count; i++) {
+			if (oi->resources[i].res_id == path->res_id) {
+				r = &oi->resources[i];
+				break;
+			}
 		}
 	}
 
@@ -99,6 +99,9 @@ static int client_connect(struct mqtt_client *client)
 	/* Reset the unanswered ping count for a new connection */
 	client->unacked_ping = 0;
 
+	/* Nothing is in flight on a new connection */
+	mqtt_inflight_reset(client);
+
 	NET_INFO("Connect completed");
 
 	return 0;
@@ -318,6 +321,14 @@ int mqtt_publish(struct mqtt_client *client,
 		goto error;
 	}
 
+#if defined(CONFIG_MQTT_INFLIGHT_WINDOW)
+	if (param->message.topic.qos != MQTT_QOS_0_AT_MOST_ONCE &&
+	    client->internal.inflight_publish >= client->internal.inflight_publish_max) {
+		err_code = -EAGAIN;
+		goto error;
+	}
+#endif /* CONFIG_MQTT_INFLIGHT_WINDOW */
+
 	err_code = publish_encode(client, param, &packet);
 	if (err_code < 0) {
 		goto error;
@@ -335,6 +346,12 @@ int mqtt_publish(struct mqtt_client *client,
 
 	err_code = client_write_msg(client, &msg);
 
+#if defined(CONFIG_MQTT_INFLIGHT_WINDOW)
+	if (err_code == 0 && param->message.topic.qos != MQTT_QOS_0_AT_MOST_ONCE) {
+		client->internal.inflight_publish++;
+	}
+#endif /* CONFIG_MQTT_INFLIGHT_WINDOW */
+
 error:
 	NET_DBG("[CID %p]:[State 0x%02x]: << result 0x%08x",
 			 client, client->internal.state, err_code);
@@ -520,6 +520,39 @@ static inline void set_disconnect_reason(struct mqtt_client *client,
 }
 #endif /* CONFIG_MQTT_VERSION_5_0 */
 
+#if defined(CONFIG_MQTT_INFLIGHT_WINDOW)
+/**@brief Reset the in-flight publish window of a new connection.
+ *
+ * @param[inout] MQTT client.
+ */
+static inline void mqtt_inflight_reset(struct mqtt_client *client)
+{
+	client->internal.inflight_publish = 0U;
+	client->internal.inflight_publish_max = CONFIG_MQTT_INFLIGHT_WINDOW_SIZE;
+}
+
+/**@brief Release an in-flight publish slot once its QoS flow completed.
+ *
+ * @param[inout] MQTT client.
+ */
+static inline void mqtt_inflight_release(struct mqtt_client *client)
+{
+	if (client->internal.inflight_publish > 0U) {
+		client->internal.inflight_publish--;
+	}
+}
+#else
+static inline void mqtt_inflight_reset(struct mqtt_client *client)
+{
+	ARG_UNUSED(client);
+}
+
+static inline void mqtt_inflight_release(struct mqtt_client *client)
+{
+	ARG_UNUSED(client);
+}
+#endif /* CONFIG_MQTT_INFLIGHT_WINDOW */
+
 /**
  * @brief Unpacks variable length integer from the buffer from the offset
  *        requested.
@@ -45,6 +45,14 @@ static int mqtt_handle_packet(struct mqtt_client *client,
 						MQTT_CONNECTION_ACCEPTED) {
 				/* Set state. */
 				MQTT_SET_STATE(client, MQTT_STATE_CONNECTED);
+#if defined(CONFIG_MQTT_INFLIGHT_WINDOW) && defined(CONFIG_MQTT_VERSION_5_0)
+				/* Never exceed the server's Receive Maximum. */
+				if (evt.param.connack.prop.rx.has_receive_maximum) {
+					client->internal.inflight_publish_max =
+						MIN(CONFIG_MQTT_INFLIGHT_WINDOW_SIZE,
+						    evt.param.connack.prop.receive_maximum);
+				}
+#endif
 			} else {
 				err_code = -ECONNREFUSED;
 			}
@@ -80,6 +88,9 @@ static int mqtt_handle_packet(struct mqtt_client *client,
 		evt.type = MQTT_EVT_PUBACK;
 		err_code = publish_ack_decode(client, buf, &evt.param.puback);
 		evt.result = err_code;
+		if (err_code == 0) {
+			mqtt_inflight_release(client);
+		}
 		break;
 
 	case MQTT_PKT_TYPE_PUBREC:
@@ -89,6 +100,12 @@ static int mqtt_handle_packet(struct mqtt_client *client,
 		err_code = publish_receive_decode(client, buf,
 						  &evt.param.pubrec);
 		evt.result = err_code;
+#if defined(CONFIG_MQTT_VERSION_5_0)
+		/* A failure reason code ends the QoS 2 flow, no PUBCOMP follows. */
+		if (err_code == 0 && evt.param.pubrec.reason_code >= 0x80) {
+			mqtt_inflight_release(client);
+		}
+#endif
 		break;
 
 	case MQTT_PKT_TYPE_PUBREL:
@@ -107,6 +124,9 @@ static int mqtt_handle_packet(struct mqtt_client *client,
 		err_code = publish_complete_decode(client, buf,
 						   &evt.param.pubcomp);
 		evt.result = err_code;
+		if (err_code == 0) {
+			mqtt_inflight_release(client);
+		}
 		break;
 
 	case MQTT_PKT_TYPE_SUBACK:
@@ -0,0 +1,213 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/sys/mem_stats.h>
+#include <zephyr/net/prometheus/collector.h>
+#include <zephyr/net/prometheus/counter.h>
+#include <zephyr/net/prometheus/gauge.h>
+#include <zephyr/net/prometheus/kernel_stats.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(pm_kernel_stats, CONFIG_PROMETHEUS_LOG_LEVEL);
+
+/* Kernel metrics are not stored anywhere, they are read from the kernel when
+ * the collector is scraped.
+ */
+static int kernel_stats_scrape(struct prometheus_collector *collector,
+			       struct prometheus_metric *metric,
+			       void *user_data);
+
+PROMETHEUS_COLLECTOR_DEFINE(kernel_stats_collector, kernel_stats_scrape);
+
+static PROMETHEUS_COUNTER_DEFINE(kernel_uptime_ms, "Kernel uptime in milliseconds",
+				 ({ .key = "kernel", .value = "uptime" }),
+				 &kernel_stats_collector);
+
+#if defined(CONFIG_SYS_HEAP_RUNTIME_STATS) && (K_HEAP_MEM_POOL_SIZE > 0)
+extern struct k_heap _system_heap;
+
+static PROMETHEUS_GAUGE_DEFINE(kernel_heap_free_bytes, "System heap free bytes",
+			       ({ .key = "heap", .value = "system" }),
+			       &kernel_stats_collector);
+static PROMETHEUS_GAUGE_DEFINE(kernel_heap_allocated_bytes, "System heap allocated bytes",
+			       ({ .key = "heap", .value = "system" }),
+			       &kernel_stats_collector);
+static PROMETHEUS_GAUGE_DEFINE(kernel_heap_max_allocated_bytes,
+			       "System heap maximum allocated bytes",
+			       ({ .key = "heap", .value = "system" }),
+			       &kernel_stats_collector);
+#define KERNEL_STATS_HEAP 1
+#endif
+
+#if defined(CONFIG_SCHED_THREAD_USAGE_ALL)
+static PROMETHEUS_COUNTER_DEFINE(kernel_execution_cycles, "Total cycles of all CPUs",
+				 ({ .key = "cpu", .value = "all" }),
+				 &kernel_stats_collector);
+static PROMETHEUS_COUNTER_DEFINE(kernel_idle_cycles, "Idle cycles of all CPUs",
+				 ({ .key = "cpu", .value = "all" }),
+				 &kernel_stats_collector);
+
+static uint64_t kernel_execution_cycles_last;
+static uint64_t kernel_idle_cycles_last;
+
+/* Counters must not go down. When the kernel statistics were reset the source
+ * starts again from zero, so its whole new value is added to the counter.
+ */
+static int counter_update(struct prometheus_counter *counter, uint64_t *last, uint64_t value)
+{
+	uint64_t delta = (value >= *last) ? (value - *last) : value;
+
+	*last = value;
+
+	return prometheus_counter_add(counter, delta);
+}
+#endif
+
+#if defined(CONFIG_OBJ_CORE_STATS_MEM_SLAB)
+static PROMETHEUS_GAUGE_DEFINE(kernel_mem_slab_free_bytes, "Memory slabs free bytes",
+			       ({ .key = "mem_slab", .value = "all" }),
+			       &kernel_stats_collector);
+static PROMETHEUS_GAUGE_DEFINE(kernel_mem_slab_allocated_bytes,
+			       "Memory slabs allocated bytes",
+			       ({ .key = "mem_slab", .value = "all" }),
+			       &kernel_stats_collector);
+
+static int mem_slab_stats_sum(struct k_obj_core *obj_core, void *data)
+{
+	struct sys_memory_stats *sum = data;
+	struct sys_memory_stats stats;
+
+	if (k_obj_core_stats_query(obj_core, &stats, sizeof(stats)) == 0) {
+		sum->free_bytes += stats.free_bytes;
+		sum->allocated_bytes += stats.allocated_bytes;
+	}
+
+	return 0;
+}
+
+static void mem_slab_stats_get(struct sys_memory_stats *sum)
+{
+	struct k_obj_type *type = k_obj_type_find(K_OBJ_TYPE_MEM_SLAB_ID);
+
+	memset(sum, 0, sizeof(*sum));
+
+	if (type != NULL) {
+		(void)k_obj_type_walk_locked(type, mem_slab_stats_sum, sum);
+	}
+}
+#endif
+
+static int kernel_stats_scrape(struct prometheus_collector *collector,
+			       struct prometheus_metric *metric,
+			       void *user_data)
+{
+	ARG_UNUSED(collector);
+	ARG_UNUSED(user_data);
+
+	if (metric == &kernel_uptime_ms.base) {
+		return prometheus_counter_set(&kernel_uptime_ms, (uint64_t)k_uptime_get());
+	}
+
+#if defined(KERNEL_STATS_HEAP)
+	if (metric == &kernel_heap_free_bytes.base ||
+	    metric == &kernel_heap_allocated_bytes.base ||
+	    metric == &kernel_heap_max_allocated_bytes.base) {
+		struct sys_memory_stats stats;
+		int ret;
+
+		ret = sys_heap_runtime_stats_get(&_system_heap.heap, &stats);
+		if (ret < 0) {
+			return -EAGAIN;
+		}
+
+		if (metric == &kernel_heap_free_bytes.base) {
+			return prometheus_gauge_set(&kernel_heap_free_bytes,
+						    (double)stats.free_bytes);
+		} else if (metric == &kernel_heap_allocated_bytes.base) {
+			return prometheus_gauge_set(&kernel_heap_allocated_bytes,
+						    (double)stats.allocated_bytes);
+		}
+
+		return prometheus_gauge_set(&kernel_heap_max_allocated_bytes,
+					    (double)stats.max_allocated_bytes);
+	}
+#endif
+
+#if defined(CONFIG_SCHED_THREAD_USAGE_ALL)
+	if (metric == &kernel_execution_cycles.base || metric == &kernel_idle_cycles.base) {
+		k_thread_runtime_stats_t stats;
+
+		if (k_thread_runtime_stats_all_get(&stats) < 0) {
+			return -EAGAIN;
+		}
+
+		if (metric == &kernel_execution_cycles.base) {
+			return counter_update(&kernel_execution_cycles,
+					      &kernel_execution_cycles_last,
+					      stats.execution_cycles);
+		}
+
+		return counter_update(&kernel_idle_cycles, &kernel_idle_cycles_last,
+				      stats.idle_cycles);
+	}
+#endif
+
+#if defined(CONFIG_OBJ_CORE_STATS_MEM_SLAB)
+	if (metric == &kernel_mem_slab_free_bytes.base ||
+	    metric == &kernel_mem_slab_allocated_bytes.base) {
+		struct sys_memory_stats stats;
+
+		mem_slab_stats_get(&stats);
+
+		if (metric == &kernel_mem_slab_free_bytes.base) {
+			return prometheus_gauge_set(&kernel_mem_slab_free_bytes,
+						    (double)stats.free_bytes);
+		}
+
+		return prometheus_gauge_set(&kernel_mem_slab_allocated_bytes,
+					    (double)stats.allocated_bytes);
+	}
+#endif
+
+	return -EAGAIN;
+}
+
+static int kernel_stats_init(void)
+{
+	struct prometheus_metric *metrics[] = {
+		&kernel_uptime_ms.base,
+#if defined(KERNEL_STATS_HEAP)
+		&kernel_heap_free_bytes.base,
+		&kernel_heap_allocated_bytes.base,
+		&kernel_heap_max_allocated_bytes.base,
+#endif
+#if defined(CONFIG_SCHED_THREAD_USAGE_ALL)
+		&kernel_execution_cycles.base,
+		&kernel_idle_cycles.base,
+#endif
+#if defined(CONFIG_OBJ_CORE_STATS_MEM_SLAB)
+		&kernel_mem_slab_free_bytes.base,
+		&kernel_mem_slab_allocated_bytes.base,
+#endif
+	};
+	int ret;
+
+	for (size_t i = 0; i < ARRAY_SIZE(metrics); i++) {
+		ret = prometheus_collector_register_metric(&kernel_stats_collector, metrics[i]);
+		if (ret < 0) {
+			LOG_ERR("Cannot register metric %s (%d)", metrics[i]->name, ret);
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+SYS_INIT(kernel_stats_init, APPLICATION, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
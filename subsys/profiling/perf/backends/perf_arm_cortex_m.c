@@ -0,0 +1,429 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/linker/linker-defs.h>
+#include <cmsis_core.h>
+
+/*
+ * Stack unwinder driven by the ARM exception handling ABI (EHABI) tables
+ * emitted with -funwind-tables, so that no frame pointer is needed.
+ *
+ * Every function has an entry in .ARM.exidx, sorted by address:
+ *   word 0: prel31 offset to the start of the function
+ *   word 1: EXIDX_CANTUNWIND, an inline compact entry (bit 31 set) or a
+ *           prel31 offset to the entry in .ARM.extab
+ *
+ * Only the compact personality routines (__aeabi_unwind_cpp_pr0/1/2) are
+ * interpreted, which is what the compiler emits for C code.
+ */
+
+#define EXIDX_CANTUNWIND 0x1U
+
+/* EXC_RETURN bits of an exception taken from thread mode on the process stack */
+#define EXC_RETURN_PREFIX     0xff000000U
+#define EXC_RETURN_TO_THREAD  (BIT(3) | _EXC_RETURN_SPSEL_Msk)
+
+/* Exception frame sizes, without the alignment padding */
+#define BASIC_FRAME_SIZE    0x20U
+#define EXTENDED_FRAME_SIZE 0x68U
+
+#define REG_SP 13
+#define REG_LR 14
+#define REG_PC 15
+
+struct exidx_entry {
+	uint32_t fn;
+	uint32_t insn;
+};
+
+extern const struct exidx_entry __exidx_start[];
+extern const struct exidx_entry __exidx_end[];
+
+/* Virtual register set of the frame being unwound */
+struct unwind_state {
+	uint32_t r[16];
+	/* Registers with a known value, r4-r11 are unknown in the first frame */
+	uint16_t valid;
+};
+
+/* Unwind instruction byte stream */
+struct unwind_insn {
+	const uint32_t *word;
+	uint8_t words_left;
+	uint8_t bytes_left;
+};
+
+static bool valid_stack(uintptr_t addr, k_tid_t current)
+{
+	return current->stack_info.start <= addr &&
+		addr < current->stack_info.start + current->stack_info.size;
+}
+
+static inline bool in_text_region(uintptr_t addr)
+{
+	return (addr >= (uintptr_t)__text_region_start) && (addr < (uintptr_t)__text_region_end);
+}
+
+static inline uintptr_t prel31_to_addr(const uint32_t *ptr)
+{
+	int32_t offset = ((int32_t)(*ptr << 1)) >> 1;
+
+	return (uintptr_t)ptr + offset;
+}
+
+static const struct exidx_entry *exidx_find(uintptr_t pc)
+{
+	const struct exidx_entry *first = __exidx_start;
+	const struct exidx_entry *last = __exidx_end - 1;
+	const struct exidx_entry *mid;
+
+	if ((first > last) || (pc < prel31_to_addr(&first->fn))) {
+		return NULL;
+	}
+
+	/* Find the last entry whose function starts at or before pc */
+	while (first < last) {
+		mid = first + ((last - first + 1) / 2);
+
+		if (prel31_to_addr(&mid->fn) <= pc) {
+			first = mid;
+		} else {
+			last = mid - 1;
+		}
+	}
+
+	return first;
+}
+
+static int unwind_insn_next(struct unwind_insn *insn)
+{
+	uint8_t byte;
+
+	if (insn->bytes_left == 0) {
+		if (insn->words_left == 0) {
+			/* Implicit "finish" */
+			return 0xb0;
+		}
+
+		insn->word++;
+		insn->words_left--;
+		insn->bytes_left = 4;
+	}
+
+	insn->bytes_left--;
+	byte = (*insn->word >> (insn->bytes_left * 8)) & 0xff;
+
+	return byte;
+}
+
+static bool unwind_pop(struct unwind_state *state, uint16_t mask, k_tid_t current)
+{
+	uint32_t *vsp = (uint32_t *)state->r[REG_SP];
+	bool pop_sp = (mask & BIT(REG_SP)) != 0;
+
+	for (int reg = 0; reg < 16; reg++) {
+		if ((mask & BIT(reg)) == 0) {
+			continue;
+		}
+
+		if (!valid_stack((uintptr_t)vsp, current)) {
+			return false;
+		}
+
+		state->r[reg] = *vsp++;
+		state->valid |= BIT(reg);
+	}
+
+	/* A popped sp takes precedence over the incremented one */
+	if (!pop_sp) {
+		state->r[REG_SP] = (uint32_t)vsp;
+	}
+
+	return true;
+}
+
+static bool unwind_exec(struct unwind_state *state, struct unwind_insn *insn, k_tid_t current)
+{
+	bool pc_set = false;
+	int op;
+	int op2;
+
+	while (true) {
+		op = unwind_insn_next(insn);
+
+		if ((op & 0xc0) == 0x00) {
+			/* 00xxxxxx: vsp = vsp + (xxxxxx << 2) + 4 */
+			state->r[REG_SP] += ((op & 0x3f) << 2) + 4;
+		} else if ((op & 0xc0) == 0x40) {
+			/* 01xxxxxx: vsp = vsp - (xxxxxx << 2) - 4 */
+			state->r[REG_SP] -= ((op & 0x3f) << 2) + 4;
+		} else if ((op & 0xf0) == 0x80) {
+			/* 1000iiii iiiiiiii: pop r4-r15 under mask */
+			uint16_t mask = (((op & 0x0f) << 8) | unwind_insn_next(insn)) << 4;
+
+			if (mask == 0) {
+				/* Refuse to unwind */
+				return false;
+			}
+
+			if (!unwind_pop(state, mask, current)) {
+				return false;
+			}
+
+			pc_set |= (mask & BIT(REG_PC)) != 0;
+		} else if ((op & 0xf0) == 0x90) {
+			/* 1001nnnn: vsp = r[nnnn], 13 and 15 are reserved */
+			int reg = op & 0x0f;
+
+			if ((reg == REG_SP) || (reg == REG_PC) || ((state->valid & BIT(reg)) == 0)) {
+				return false;
+			}
+
+			state->r[REG_SP] = state->r[reg];
+		} else if ((op & 0xf0) == 0xa0) {
+			/* 1010Lnnn: pop r4-r[4+nnn], and r14 if L is set */
+			uint16_t mask = GENMASK(4 + (op & 0x07), 4);
+
+			if ((op & 0x08) != 0) {
+				mask |= BIT(REG_LR);
+			}
+
+			if (!unwind_pop(state, mask, current)) {
+				return false;
+			}
+		} else if (op == 0xb0) {
+			/* 10110000: finish */
+			break;
+		} else if (op == 0xb1) {
+			/* 10110001 0000iiii: pop r0-r3 under mask */
+			op2 = unwind_insn_next(insn);
+
+			if ((op2 == 0) || ((op2 & 0xf0) != 0)) {
+				return false;
+			}
+
+			if (!unwind_pop(state, op2, current)) {
+				return false;
+			}
+		} else if (op == 0xb2) {
+			/* 10110010 uleb128: vsp = vsp + 0x204 + (uleb128 << 2) */
+			uint32_t value = 0;
+			int shift = 0;
+
+			do {
+				op2 = unwind_insn_next(insn);
+				value |= (op2 & 0x7f) << shift;
+				shift += 7;
+			} while (((op2 & 0x80) != 0) && (shift < 32));
+
+			state->r[REG_SP] += 0x204 + (value << 2);
+		} else if (op == 0xb3) {
+			/* 10110011 sssscccc: pop VFP registers saved by FSTMFDX */
+			op2 = unwind_insn_next(insn);
+			state->r[REG_SP] += ((op2 & 0x0f) + 1) * 8 + 4;
+		} else if ((op & 0xf8) == 0xb8) {
+			/* 10111nnn: pop VFP d8-d[8+nnn] saved by FSTMFDX */
+			state->r[REG_SP] += ((op & 0x07) + 1) * 8 + 4;
+		} else if ((op == 0xc8) || (op == 0xc9)) {
+			/* 1100100x sssscccc: pop VFP registers saved by VPUSH */
+			op2 = unwind_insn_next(insn);
+			state->r[REG_SP] += ((op2 & 0x0f) + 1) * 8;
+		} else if ((op & 0xf8) == 0xd0) {
+			/* 11010nnn: pop VFP d8-d[8+nnn] saved by VPUSH */
+			state->r[REG_SP] += ((op & 0x07) + 1) * 8;
+		} else {
+			/* Spare or iWMMX instructions, not used on Cortex-M */
+			return false;
+		}
+	}
+
+	if (!pc_set) {
+		state->r[REG_PC] = state->r[REG_LR];
+	}
+
+	return true;
+}
+
+static bool unwind_frame(struct unwind_state *state, k_tid_t current)
+{
+	const struct exidx_entry *entry;
+	struct unwind_insn insn;
+	const uint32_t *extab;
+	uint32_t pc = state->r[REG_PC] & ~1U;
+
+	entry = exidx_find(pc);
+	if ((entry == NULL) || (entry->insn == EXIDX_CANTUNWIND)) {
+		return false;
+	}
+
+	if ((entry->insn & BIT(31)) != 0) {
+		/* Inline compact entry, only personality routine 0 fits */
+		if ((entry->insn & 0x0f000000) != 0) {
+			return false;
+		}
+
+		insn.word = &entry->insn;
+		insn.words_left = 0;
+		insn.bytes_left = 3;
+	} else {
+		extab = (const uint32_t *)prel31_to_addr(&entry->insn);
+
+		if ((*extab & BIT(31)) == 0) {
+			/* Generic personality routine, cannot be interpreted */
+			return false;
+		}
+
+		switch ((*extab >> 24) & 0x0f) {
+		case 0:
+			insn.word = extab;
+			insn.words_left = 0;
+			insn.bytes_left = 3;
+			break;
+		case 1:
+		case 2:
+			insn.word = extab;
+			insn.words_left = (*extab >> 16) & 0xff;
+			insn.bytes_left = 2;
+			break;
+		default:
+			return false;
+		}
+	}
+
+	return unwind_exec(state, &insn, current);
+}
+
+static bool stack_contains(uintptr_t start, size_t size, k_tid_t current)
+{
+	return valid_stack(start, current) && valid_stack(start + size - 1U, current);
+}
+
+static bool interrupted_frame_get(struct unwind_state *state)
+{
+	uint32_t *frame = (uint32_t *)__get_PSP();
+	uint32_t exc_return;
+	uint32_t size = BASIC_FRAME_SIZE;
+	uint32_t sp;
+
+#if defined(CONFIG_ARMV7_M_ARMV8_M_MAINLINE)
+	/*
+	 * The perf timer runs in the system clock interrupt. Only sample when
+	 * it interrupted thread mode, otherwise PSP does not point to the
+	 * context that was interrupted.
+	 */
+	if ((SCB->ICSR & SCB_ICSR_RETTOBASE_Msk) == 0) {
+		return false;
+	}
+#endif
+
+	/*
+	 * The interrupt was taken from thread mode with an empty main stack.
+	 * The handler in the vector table saves lr, which holds EXC_RETURN,
+	 * with its first push, so it ends up in the top word of the interrupt
+	 * stack. If that word is not an EXC_RETURN to thread mode, the layout
+	 * is not the expected one and the sample is dropped.
+	 */
+	exc_return = *((uint32_t *)_current_cpu->irq_stack - 1);
+	if (((exc_return & EXC_RETURN_PREFIX) != EXC_RETURN_PREFIX) ||
+	    ((exc_return & EXC_RETURN_TO_THREAD) != EXC_RETURN_TO_THREAD)) {
+		return false;
+	}
+
+	/* The FP context follows the basic frame when it was stacked */
+	if ((exc_return & _EXC_RETURN_FTYPE_Msk) == 0) {
+		size = EXTENDED_FRAME_SIZE;
+	}
+
+	if (!stack_contains((uintptr_t)frame, size, _current)) {
+		return false;
+	}
+
+	sp = (uint32_t)frame + size;
+
+	/* Padding inserted to align the frame to 8 bytes is flagged in xPSR */
+	if ((frame[7] & BIT(9)) != 0) {
+		sp += 4;
+	}
+
+	state->r[0] = frame[0];
+	state->r[1] = frame[1];
+	state->r[2] = frame[2];
+	state->r[3] = frame[3];
+	state->r[12] = frame[4];
+	state->r[REG_LR] = frame[5];
+	state->r[REG_PC] = frame[6];
+	state->r[REG_SP] = sp;
+	state->valid = BIT(0) | BIT(1) | BIT(2) | BIT(3) | BIT(12) |
+		       BIT(REG_SP) | BIT(REG_LR) | BIT(REG_PC);
+
+	return true;
+}
+
+/*
+ * This function uses the unwind tables to get trace of return addresses.
+ * Return addresses are translated in corresponding function's names using .elf file.
+ * So we get function call trace
+ */
+size_t arch_perf_current_stack_trace(uintptr_t *buf, size_t size)
+{
+	struct unwind_state state;
+	uint32_t lr;
+	size_t idx = 0;
+
+	if (size < 2U) {
+		return 0;
+	}
+
+	if (!interrupted_frame_get(&state)) {
+		return 0;
+	}
+
+	lr = state.r[REG_LR];
+	buf[idx++] = (uintptr_t)state.r[REG_PC];
+
+	/*
+	 * Unwind tables describe the frame after the prologue. When the
+	 * interrupt hit a prologue or an epilogue the first unwind may fail,
+	 * in which case the interrupted link register is the best guess for
+	 * the caller.
+	 */
+	if (!unwind_frame(&state, _current) || !in_text_region(state.r[REG_PC] & ~1U)) {
+		if (in_text_region(lr & ~1U)) {
+			buf[idx++] = (uintptr_t)(lr & ~1U);
+		}
+
+		return idx;
+	}
+
+	while (in_text_region(state.r[REG_PC] & ~1U)) {
+		uint32_t sp = state.r[REG_SP];
+
+		if (idx >= size) {
+			return 0;
+		}
+
+		buf[idx++] = (uintptr_t)(state.r[REG_PC] & ~1U);
+
+		/* Look up the caller by the call instruction, not the return address */
+		state.r[REG_PC] = (state.r[REG_PC] & ~1U) - 2;
+
+		if (!unwind_frame(&state, _current)) {
+			break;
+		}
+
+		/*
+		 * anti-infinity-loop if
+		 * new sp can't be smaller than sp, cause the stack is growing down
+		 * and trace moves deeper into the stack
+		 */
+		if (state.r[REG_SP] <= sp) {
+			break;
+		}
+	}
+
+	return idx;
+}
@@ -10,11 +10,23 @@
 #include <zephyr/arch/cpu.h>
 #include <zephyr/shell/shell.h>
 #include <zephyr/shell/shell_uart.h>
+#include <zephyr/debug/symtab.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 size_t arch_perf_current_stack_trace(uintptr_t *buf, size_t size);
 
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+/* Unique stack trace and the number of times it was sampled */
+struct perf_stack_t {
+	uint32_t hash;
+	uint32_t count;
+	size_t depth;
+	uintptr_t ip[CONFIG_PROFILING_PERF_AGGREGATE_MAX_DEPTH];
+};
+#endif
+
 struct perf_data_t {
 	struct k_timer timer;
 
@@ -22,8 +34,16 @@ struct perf_data_t {
 
 	struct k_work_delayable dwork;
 
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+	struct perf_stack_t stacks[CONFIG_PROFILING_PERF_AGGREGATE_STACKS];
+	size_t stacks_used;
+	uint32_t samples;
+	uint32_t lost;
+	bool continuous;
+#else
 	size_t idx;
 	uintptr_t buf[CONFIG_PROFILING_PERF_BUFFER_SIZE];
+#endif
 	bool buf_full;
 };
 
@@ -34,6 +54,82 @@ static struct perf_data_t perf_data = {
 	.dwork = Z_WORK_DELAYABLE_INITIALIZER(perf_dwork_handler),
 };
 
+static bool perf_is_running(void)
+{
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+	if (perf_data.continuous) {
+		return true;
+	}
+#endif
+
+	return k_work_delayable_is_pending(&perf_data.dwork);
+}
+
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+static uint32_t perf_stack_hash(const uintptr_t *ip, size_t depth)
+{
+	/* FNV-1a over the return addresses */
+	uint32_t hash = 2166136261U;
+
+	for (size_t i = 0; i < depth; i++) {
+		hash = (hash ^ (uint32_t)ip[i]) * 16777619U;
+		if (sizeof(uintptr_t) > sizeof(uint32_t)) {
+			hash = (hash ^ (uint32_t)((uint64_t)ip[i] >> 32)) * 16777619U;
+		}
+	}
+
+	return hash;
+}
+
+static void perf_tracer(struct k_timer *timer)
+{
+	struct perf_data_t *perf_data_ptr =
+		(struct perf_data_t *)k_timer_user_data_get(timer);
+	uintptr_t ip[CONFIG_PROFILING_PERF_AGGREGATE_MAX_DEPTH];
+	size_t depth;
+	uint32_t hash;
+	size_t slot;
+
+	perf_data_ptr->samples++;
+
+	depth = arch_perf_current_stack_trace(ip, ARRAY_SIZE(ip));
+	if (depth == 0) {
+		/* Trace is deeper than CONFIG_PROFILING_PERF_AGGREGATE_MAX_DEPTH */
+		perf_data_ptr->lost++;
+		return;
+	}
+
+	hash = perf_stack_hash(ip, depth);
+	slot = hash % CONFIG_PROFILING_PERF_AGGREGATE_STACKS;
+
+	/* Open addressing with linear probing, entries are never removed
+	 * while recording so the first empty slot ends the search.
+	 */
+	for (size_t i = 0; i < CONFIG_PROFILING_PERF_AGGREGATE_STACKS; i++) {
+		struct perf_stack_t *stack = &perf_data_ptr->stacks[slot];
+
+		if (stack->count == 0U) {
+			stack->hash = hash;
+			stack->count = 1U;
+			stack->depth = depth;
+			memcpy(stack->ip, ip, depth * sizeof(ip[0]));
+			perf_data_ptr->stacks_used++;
+			return;
+		}
+
+		if (stack->hash == hash && stack->depth == depth &&
+		    memcmp(stack->ip, ip, depth * sizeof(ip[0])) == 0) {
+			stack->count++;
+			return;
+		}
+
+		slot = (slot + 1) % CONFIG_PROFILING_PERF_AGGREGATE_STACKS;
+	}
+
+	perf_data_ptr->lost++;
+	perf_data_ptr->buf_full = true;
+}
+#else
 static void perf_tracer(struct k_timer *timer)
 {
 	struct perf_data_t *perf_data_ptr =
@@ -56,6 +152,7 @@ static void perf_tracer(struct k_timer *timer)
 		k_work_reschedule(&perf_data_ptr->dwork, K_NO_WAIT);
 	}
 }
+#endif /* CONFIG_PROFILING_PERF_AGGREGATE */
 
 static void perf_dwork_handler(struct k_work *work)
 {
@@ -72,17 +169,17 @@ static void perf_dwork_handler(struct k_work *work)
 
 static int cmd_perf_record(const struct shell *sh, size_t argc, char **argv)
 {
-	if (k_work_delayable_is_pending(&perf_data.dwork)) {
+	if (perf_is_running()) {
 		shell_warn(sh, "Perf is running");
 		return -EINPROGRESS;
 	}
 
-	if (perf_data.buf_full) {
+	if (!IS_ENABLED(CONFIG_PROFILING_PERF_AGGREGATE) && perf_data.buf_full) {
 		shell_warn(sh, "Perf buffer is full");
 		return -ENOBUFS;
 	}
 
-	k_timeout_t duration = K_MSEC(strtoll(argv[1], NULL, 10));
+	long long duration_ms = strtoll(argv[1], NULL, 10);
 	k_timeout_t period = K_NSEC(1000000000 / strtoll(argv[2], NULL, 10));
 
 	perf_data.sh = sh;
@@ -90,24 +187,58 @@ static int cmd_perf_record(const struct shell *sh, size_t argc, char **argv)
 	k_timer_user_data_set(&perf_data.timer, &perf_data);
 	k_timer_start(&perf_data.timer, K_NO_WAIT, period);
 
-	k_work_schedule(&perf_data.dwork, duration);
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+	if (duration_ms == 0) {
+		/* Continuous recording, runs until "perf stop" */
+		perf_data.continuous = true;
+		shell_print(sh, "Enabled perf (continuous)");
+		return 0;
+	}
+#endif
+
+	k_work_schedule(&perf_data.dwork, K_MSEC(duration_ms));
 
 	shell_print(sh, "Enabled perf");
 
 	return 0;
 }
 
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+static int cmd_perf_stop(const struct shell *sh, size_t argc, char **argv)
+{
+	if (!perf_is_running()) {
+		shell_warn(sh, "Perf is not running");
+		return -EALREADY;
+	}
+
+	k_timer_stop(&perf_data.timer);
+	k_work_cancel_delayable(&perf_data.dwork);
+	perf_data.continuous = false;
+
+	shell_print(sh, "Perf stopped");
+
+	return 0;
+}
+#endif
+
 static int cmd_perf_clear(const struct shell *sh, size_t argc, char **argv)
 {
 	if (sh != NULL) {
-		if (k_work_delayable_is_pending(&perf_data.dwork)) {
+		if (perf_is_running()) {
 			shell_warn(sh, "Perf is running");
 			return -EINPROGRESS;
 		}
 		shell_print(sh, "Perf buffer cleared");
 	}
 
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+	memset(perf_data.stacks, 0, sizeof(perf_data.stacks));
+	perf_data.stacks_used = 0;
+	perf_data.samples = 0;
+	perf_data.lost = 0;
+#else
 	perf_data.idx = 0;
+#endif
 	perf_data.buf_full = false;
 
 	return 0;
@@ -115,19 +246,72 @@ static int cmd_perf_clear(const struct shell *sh, size_t argc, char **argv)
 
 static int cmd_perf_info(const struct shell *sh, size_t argc, char **argv)
 {
-	if (k_work_delayable_is_pending(&perf_data.dwork)) {
+	if (perf_is_running()) {
 		shell_print(sh, "Perf is running");
 	}
 
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+	shell_print(sh, "Perf stacks: %zu/%d %s", perf_data.stacks_used,
+		    CONFIG_PROFILING_PERF_AGGREGATE_STACKS, perf_data.buf_full ? "(full)" : "");
+	shell_print(sh, "Perf samples: %u, lost: %u", perf_data.samples, perf_data.lost);
+#else
 	shell_print(sh, "Perf buf: %zu/%d %s", perf_data.idx, CONFIG_PROFILING_PERF_BUFFER_SIZE,
 		    perf_data.buf_full ? "(full)" : "");
+#endif
 
 	return 0;
 }
 
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+static void perf_print_frame(const struct shell *sh, uintptr_t addr)
+{
+#ifdef CONFIG_SYMTAB
+	uint32_t offset;
+
+	shell_fprintf(sh, SHELL_NORMAL, "%s", symtab_find_symbol_name(addr, &offset));
+#else
+	shell_fprintf(sh, SHELL_NORMAL, "0x%lx", addr);
+#endif
+}
+
 static int cmd_perf_print(const struct shell *sh, size_t argc, char **argv)
 {
-	if (k_work_delayable_is_pending(&perf_data.dwork)) {
+	/* Stacks are printed in the folded format ("root;...;leaf count"),
+	 * while recording, counts of a stack may be off by the samples taken
+	 * during printing.
+	 */
+	for (size_t i = 0; i < CONFIG_PROFILING_PERF_AGGREGATE_STACKS; i++) {
+		struct perf_stack_t *stack = &perf_data.stacks[i];
+		uint32_t count = stack->count;
+
+		if (count == 0U) {
+			continue;
+		}
+
+		for (size_t j = stack->depth; j > 0; j--) {
+			/* Return addresses point after the call instruction,
+			 * step back so they resolve to the calling function.
+			 */
+			perf_print_frame(sh, stack->ip[j - 1] - (j > 1 ? 1 : 0));
+			shell_fprintf(sh, SHELL_NORMAL, "%s", j > 1 ? ";" : " ");
+		}
+		shell_fprintf(sh, SHELL_NORMAL, "%u\n", count);
+	}
+
+	if (argc > 1 && strcmp(argv[1], "-c") == 0) {
+		if (perf_is_running()) {
+			shell_warn(sh, "Perf is running, not clearing");
+			return -EINPROGRESS;
+		}
+		cmd_perf_clear(NULL, 0, NULL);
+	}
+
+	return 0;
+}
+#else
+static int cmd_perf_print(const struct shell *sh, size_t argc, char **argv)
+{
+	if (perf_is_running()) {
 		shell_warn(sh, "Perf is running");
 		return -EINPROGRESS;
 	}
@@ -141,14 +325,33 @@ static int cmd_perf_print(const struct shell *sh, size_t argc, char **argv)
 
 	return 0;
 }
+#endif /* CONFIG_PROFILING_PERF_AGGREGATE */
 
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+#define CMD_HELP_RECORD                                                                            \
+	"Start recording for <duration> ms on <frequency> Hz,\n"                                   \
+	"a duration of 0 records until \"perf stop\"\n"                                            \
+	"Usage: record <duration> <frequency>"
+
+#define CMD_HELP_PRINT                                                                             \
+	"Print sampled stacks in folded format, -c clears them afterwards\n"                       \
+	"Usage: printbuf [-c]"
+#define CMD_PRINT_OPT_ARGS 1
+#else
 #define CMD_HELP_RECORD                                                                            \
 	"Start recording for <duration> ms on <frequency> Hz\n"                                    \
 	"Usage: record <duration> <frequency>"
 
+#define CMD_HELP_PRINT "Print the perf buffer"
+#define CMD_PRINT_OPT_ARGS 0
+#endif
+
 SHELL_STATIC_SUBCMD_SET_CREATE(m_sub_perf,
 	SHELL_CMD_ARG(record, NULL, CMD_HELP_RECORD, cmd_perf_record, 3, 0),
-	SHELL_CMD_ARG(printbuf, NULL, "Print the perf buffer", cmd_perf_print, 0, 0),
+	SHELL_COND_CMD_ARG(CONFIG_PROFILING_PERF_AGGREGATE, stop, NULL, "Stop recording",
+			   COND_CODE_1(CONFIG_PROFILING_PERF_AGGREGATE, (cmd_perf_stop), (NULL)),
+			   0, 0),
+	SHELL_CMD_ARG(printbuf, NULL, CMD_HELP_PRINT, cmd_perf_print, 0, CMD_PRINT_OPT_ARGS),
 	SHELL_CMD_ARG(clear, NULL, "Clear the perf buffer", cmd_perf_clear, 0, 0),
 	SHELL_CMD_ARG(info, NULL, "Print the perf info", cmd_perf_info, 0, 0),
 	SHELL_SUBCMD_SET_END
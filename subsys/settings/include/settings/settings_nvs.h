@@ -48,6 +48,19 @@ struct settings_nvs {
 	uint16_t cache_total;
 	bool loaded;
 #endif
+#if CONFIG_SETTINGS_NVS_BULK_LOAD
+	/* Newest name and value entries of the items with name ids in
+	 * (bulk_first_id, bulk_last_id], indexed by bulk_last_id - name_id.
+	 */
+	struct {
+		struct nvs_walk_entry name;
+		struct nvs_walk_entry value;
+	} bulk[CONFIG_SETTINGS_NVS_BULK_LOAD_SIZE];
+
+	uint16_t bulk_first_id;
+	uint16_t bulk_last_id;
+	uint16_t bulk_pending;
+#endif
 };
 
 /* register nvs to be a source of settings */
@@ -29,11 +29,187 @@ static K_MUTEX_DEFINE(settings_lock);
 
 void settings_store_init(void);
 
+#if defined(CONFIG_SETTINGS_HANDLER_INDEX)
+/*
+ * The static handlers are indexed by a tree in which the children of a handler
+ * are the handlers whose name extends its name, e.g. "bt/mesh" is a child of
+ * "bt". Siblings never match the same name, so a lookup follows a single path
+ * from the root instead of comparing the name against every handler. The top
+ * level handlers are also kept sorted by the first component of their name,
+ * which is looked up with a binary search. Nodes are stored as the handler's
+ * index in the iterable section plus one, 0 meaning none.
+ */
+static struct {
+	uint16_t child;
+	uint16_t sibling;
+} settings_index[CONFIG_SETTINGS_HANDLER_INDEX_SIZE];
+static uint16_t settings_index_root;
+static uint16_t settings_index_top[CONFIG_SETTINGS_HANDLER_INDEX_SIZE];
+static uint16_t settings_index_top_count;
+static bool settings_index_ready;
+
+static struct settings_handler_static *settings_index_handler(uint16_t node)
+{
+	struct settings_handler_static *ch;
+
+	STRUCT_SECTION_GET(settings_handler_static, node - 1, &ch);
+
+	return ch;
+}
+
+/* Compare the first name components of two settings names */
+static int settings_index_cmp(const char *a, const char *b)
+{
+	int alen = settings_name_next(a, NULL);
+	int blen = settings_name_next(b, NULL);
+	int rc;
+
+	rc = strncmp(a, b, MIN(alen, blen));
+	if (rc != 0) {
+		return rc;
+	}
+
+	return alen - blen;
+}
+
+static void settings_index_insert(uint16_t node)
+{
+	const char *name = settings_index_handler(node)->name;
+	uint16_t *link = &settings_index_root;
+	uint16_t *pos;
+	uint16_t cur;
+
+	/* Descend to the most specific handler extended by the new one. A
+	 * handler with the same name as an earlier one becomes its child, so
+	 * that it takes precedence as it does in a linear search.
+	 */
+	cur = *link;
+	while (cur != 0) {
+		if (settings_name_steq(name, settings_index_handler(cur)->name, NULL)) {
+			link = &settings_index[cur - 1].child;
+			cur = *link;
+		} else {
+			cur = settings_index[cur - 1].sibling;
+		}
+	}
+
+	/* Adopt the siblings that extend the new handler */
+	pos = link;
+	while (*pos != 0) {
+		cur = *pos;
+		if (settings_name_steq(settings_index_handler(cur)->name, name, NULL)) {
+			*pos = settings_index[cur - 1].sibling;
+			settings_index[cur - 1].sibling = settings_index[node - 1].child;
+			settings_index[node - 1].child = cur;
+		} else {
+			pos = &settings_index[cur - 1].sibling;
+		}
+	}
+
+	settings_index[node - 1].sibling = *link;
+	*link = node;
+}
+
+static void settings_index_build(void)
+{
+	int count;
+
+	STRUCT_SECTION_COUNT(settings_handler_static, &count);
+
+	settings_index_ready = false;
+	settings_index_root = 0;
+	memset(settings_index, 0, sizeof(settings_index));
+
+	if ((size_t)count > ARRAY_SIZE(settings_index)) {
+		LOG_WRN("%d static handlers exceed the index size, using linear lookup", count);
+		return;
+	}
+
+	for (int i = 0; i < count; i++) {
+		settings_index_insert(i + 1);
+	}
+
+	/* Sort the top level handlers, the count is small so insertion sort is enough */
+	settings_index_top_count = 0;
+	for (uint16_t cur = settings_index_root; cur != 0; cur = settings_index[cur - 1].sibling) {
+		const char *name = settings_index_handler(cur)->name;
+		uint16_t pos = settings_index_top_count;
+
+		while (pos > 0 &&
+		       settings_index_cmp(settings_index_handler(settings_index_top[pos - 1])->name,
+					  name) > 0) {
+			settings_index_top[pos] = settings_index_top[pos - 1];
+			pos--;
+		}
+		settings_index_top[pos] = cur;
+		settings_index_top_count++;
+	}
+
+	settings_index_ready = true;
+}
+
+static struct settings_handler_static *settings_index_lookup(const char *name,
+							     const char **next)
+{
+	struct settings_handler_static *bestmatch = NULL;
+	struct settings_handler_static *ch;
+	const char *tmpnext;
+	uint16_t low = 0;
+	uint16_t high = settings_index_top_count;
+	uint16_t cur = 0;
+
+	/* Find the first top level handler sharing the first name component */
+	while (low < high) {
+		uint16_t mid = low + (high - low) / 2;
+
+		ch = settings_index_handler(settings_index_top[mid]);
+		if (settings_index_cmp(ch->name, name) < 0) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+
+	for (; low < settings_index_top_count; low++) {
+		ch = settings_index_handler(settings_index_top[low]);
+		if (settings_index_cmp(ch->name, name) != 0) {
+			break;
+		}
+		if (settings_name_steq(name, ch->name, &tmpnext)) {
+			bestmatch = ch;
+			if (next) {
+				*next = tmpnext;
+			}
+			cur = settings_index[settings_index_top[low] - 1].child;
+			break;
+		}
+	}
+
+	while (cur != 0) {
+		ch = settings_index_handler(cur);
+		if (!settings_name_steq(name, ch->name, &tmpnext)) {
+			cur = settings_index[cur - 1].sibling;
+			continue;
+		}
+		bestmatch = ch;
+		if (next) {
+			*next = tmpnext;
+		}
+		cur = settings_index[cur - 1].child;
+	}
+
+	return bestmatch;
+}
+#endif /* CONFIG_SETTINGS_HANDLER_INDEX */
+
 void settings_init(void)
 {
 #if defined(CONFIG_SETTINGS_DYNAMIC_HANDLERS)
 	sys_slist_init(&settings_handlers);
 #endif /* CONFIG_SETTINGS_DYNAMIC_HANDLERS */
+#if defined(CONFIG_SETTINGS_HANDLER_INDEX)
+	settings_index_build();
+#endif /* CONFIG_SETTINGS_HANDLER_INDEX */
 	settings_store_init();
 }
 
@@ -143,17 +319,19 @@ int settings_name_next(const char *name, const char **next)
 	return rc;
 }
 
-struct settings_handler_static *settings_parse_and_lookup(const char *name,
-							const char **next)
+static struct settings_handler_static *settings_static_lookup(const char *name,
+							      const char **next)
 {
 	struct settings_handler_static *bestmatch;
 	const char *tmpnext;
 
-	bestmatch = NULL;
-	if (next) {
-		*next = NULL;
+#if defined(CONFIG_SETTINGS_HANDLER_INDEX)
+	if (settings_index_ready) {
+		return settings_index_lookup(name, next);
 	}
+#endif /* CONFIG_SETTINGS_HANDLER_INDEX */
 
+	bestmatch = NULL;
 	STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
 		if (!settings_name_steq(name, ch->name, &tmpnext)) {
 			continue;
@@ -173,8 +351,23 @@ struct settings_handler_static *settings_parse_and_lookup(const char *name,
 		}
 	}
 
+	return bestmatch;
+}
+
+struct settings_handler_static *settings_parse_and_lookup(const char *name,
+							const char **next)
+{
+	struct settings_handler_static *bestmatch;
+
+	if (next) {
+		*next = NULL;
+	}
+
+	bestmatch = settings_static_lookup(name, next);
+
 #if defined(CONFIG_SETTINGS_DYNAMIC_HANDLERS)
 	struct settings_handler *ch;
+	const char *tmpnext;
 
 	SYS_SLIST_FOR_EACH_CONTAINER(&settings_handlers, ch, node) {
 		if (!settings_name_steq(name, ch->name, &tmpnext)) {
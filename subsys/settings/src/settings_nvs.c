@@ -26,6 +26,9 @@ LOG_MODULE_DECLARE(settings, CONFIG_SETTINGS_LOG_LEVEL);
 struct settings_nvs_read_fn_arg {
 	struct nvs_fs *fs;
 	uint16_t id;
+#if CONFIG_SETTINGS_NVS_BULK_LOAD
+	const struct nvs_walk_entry *entry;
+#endif
 };
 
 static int settings_nvs_load(struct settings_store *cs,
@@ -47,7 +50,18 @@ static ssize_t settings_nvs_read_fn(void *back_end, void *data, size_t len)
 
 	rd_fn_arg = (struct settings_nvs_read_fn_arg *)back_end;
 
+#if CONFIG_SETTINGS_NVS_BULK_LOAD
+	rc = -ENOENT;
+	if (rd_fn_arg->entry != NULL) {
+		rc = nvs_walk_read(rd_fn_arg->fs, rd_fn_arg->entry, data, len);
+	}
+	if (rc == -ENOENT) {
+		/* Not located by the walk, or moved by garbage collection since */
+		rc = nvs_read(rd_fn_arg->fs, rd_fn_arg->id, data, len);
+	}
+#else
 	rc = nvs_read(rd_fn_arg->fs, rd_fn_arg->id, data, len);
+#endif
 	if (rc > (ssize_t)len) {
 		/* nvs_read signals that not all bytes were read
 		 * align read len to what was requested
@@ -120,6 +134,66 @@ static uint16_t settings_nvs_cache_match(struct settings_nvs *cf, const char *na
 }
 #endif /* CONFIG_SETTINGS_NVS_NAME_CACHE */
 
+#if CONFIG_SETTINGS_NVS_BULK_LOAD
+static inline uint16_t settings_nvs_bulk_idx(struct settings_nvs *cf, uint16_t name_id)
+{
+	if ((name_id <= cf->bulk_first_id) || (name_id > cf->bulk_last_id)) {
+		return UINT16_MAX;
+	}
+
+	return cf->bulk_last_id - name_id;
+}
+
+static int settings_nvs_bulk_walk_cb(const struct nvs_walk_entry *entry, void *arg)
+{
+	struct settings_nvs *cf = arg;
+	struct nvs_walk_entry *slot;
+	uint16_t idx;
+
+	if (entry->id > NVS_NAMECNT_ID + NVS_NAME_ID_OFFSET) {
+		idx = settings_nvs_bulk_idx(cf, entry->id - NVS_NAME_ID_OFFSET);
+		slot = (idx == UINT16_MAX) ? NULL : &cf->bulk[idx].value;
+	} else {
+		idx = settings_nvs_bulk_idx(cf, entry->id);
+		slot = (idx == UINT16_MAX) ? NULL : &cf->bulk[idx].name;
+	}
+
+	/* Only the newest entry of an id, which is walked first, is kept */
+	if ((slot == NULL) || (slot->id != 0U)) {
+		return 0;
+	}
+
+	*slot = *entry;
+	cf->bulk_pending--;
+
+	/* Stop the walk as soon as everything has been located */
+	return (cf->bulk_pending == 0U) ? 1 : 0;
+}
+
+static bool settings_nvs_bulk_locate(struct settings_nvs *cf)
+{
+	int rc;
+
+	cf->bulk_last_id = cf->last_name_id;
+	cf->bulk_first_id = MAX(NVS_NAMECNT_ID,
+				(int)cf->last_name_id - CONFIG_SETTINGS_NVS_BULK_LOAD_SIZE);
+	cf->bulk_pending = 2 * (cf->bulk_last_id - cf->bulk_first_id);
+	memset(cf->bulk, 0, sizeof(cf->bulk));
+
+	if (cf->bulk_pending == 0U) {
+		return false;
+	}
+
+	rc = nvs_walk(&cf->cf_nvs, settings_nvs_bulk_walk_cb, cf);
+	if (rc < 0) {
+		LOG_WRN("NVS walk failed (%d), loading items one by one", rc);
+		return false;
+	}
+
+	return true;
+}
+#endif /* CONFIG_SETTINGS_NVS_BULK_LOAD */
+
 static int settings_nvs_load(struct settings_store *cs,
 			     const struct settings_load_arg *arg)
 {
@@ -136,6 +210,15 @@ static int settings_nvs_load(struct settings_store *cs,
 
 	cf->loaded = false;
 #endif
+#if CONFIG_SETTINGS_NVS_BULK_LOAD
+	uint32_t bulk_gc_count;
+	uint16_t idx = UINT16_MAX;
+	bool bulk;
+
+	bulk_gc_count = nvs_gc_count_get(&cf->cf_nvs);
+	bulk = settings_nvs_bulk_locate(cf);
+	read_fn_arg.entry = NULL;
+#endif
 
 	name_id = cf->last_name_id + 1;
 
@@ -154,9 +237,27 @@ static int settings_nvs_load(struct settings_store *cs,
 		 * entries one for the setting's name and one with the
 		 * setting's value.
 		 */
-		rc1 = nvs_read(&cf->cf_nvs, name_id, &name, sizeof(name));
-		rc2 = nvs_read(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET,
-			       &buf, sizeof(buf));
+#if CONFIG_SETTINGS_NVS_BULK_LOAD
+		if (bulk && (nvs_gc_count_get(&cf->cf_nvs) != bulk_gc_count)) {
+			/* Garbage collection may have moved the located entries */
+			bulk = false;
+		}
+
+		idx = bulk ? settings_nvs_bulk_idx(cf, name_id) : UINT16_MAX;
+		if (idx != UINT16_MAX) {
+			/* Entries that were not located do not exist */
+			rc1 = (cf->bulk[idx].name.len == 0U) ? -ENOENT :
+			      nvs_walk_read(&cf->cf_nvs, &cf->bulk[idx].name, &name,
+					    sizeof(name));
+			rc2 = (cf->bulk[idx].value.len == 0U) ? -ENOENT :
+			      (ssize_t)cf->bulk[idx].value.len;
+		} else
+#endif
+		{
+			rc1 = nvs_read(&cf->cf_nvs, name_id, &name, sizeof(name));
+			rc2 = nvs_read(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET,
+				       &buf, sizeof(buf));
+		}
 
 		if ((rc1 <= 0) && (rc2 <= 0)) {
 			/* Settings largest ID in use is invalid due to
@@ -195,6 +296,9 @@ static int settings_nvs_load(struct settings_store *cs,
 		name[rc1] = '\0';
 		read_fn_arg.fs = &cf->cf_nvs;
 		read_fn_arg.id = name_id + NVS_NAME_ID_OFFSET;
+#if CONFIG_SETTINGS_NVS_BULK_LOAD
+		read_fn_arg.entry = (idx != UINT16_MAX) ? &cf->bulk[idx].value : NULL;
+#endif
 
 #if CONFIG_SETTINGS_NVS_NAME_CACHE
 		settings_nvs_cache_add(cf, name, name_id);
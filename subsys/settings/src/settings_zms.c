@@ -393,17 +393,38 @@ static int settings_zms_load(struct settings_store *cs, const struct settings_lo
 	return ret;
 }
 
+/* Make the linked list node of name_hash the last one once it is written */
+static void settings_zms_ll_append(struct settings_zms *cf, uint32_t name_hash,
+				   const struct settings_hash_linked_list *prev_element)
+{
+	cf->second_to_last_hash_id = cf->last_hash_id;
+	cf->last_hash_id = ZMS_LL_NODE_FROM_NAME_ID(name_hash);
+#ifdef CONFIG_SETTINGS_ZMS_LL_CACHE
+	if (cf->ll_cache_next < CONFIG_SETTINGS_ZMS_LL_CACHE_SIZE) {
+		cf->ll_cache[cf->ll_cache_next] = *prev_element;
+		cf->ll_cache_next = cf->ll_cache_next + 1;
+	}
+#else
+	ARG_UNUSED(prev_element);
+#endif
+}
+
 static int settings_zms_save(struct settings_store *cs, const char *name, const char *value,
 			     size_t val_len)
 {
 	struct settings_zms *cf = CONTAINER_OF(cs, struct settings_zms, cf_store);
 	struct settings_hash_linked_list settings_element;
+	struct settings_hash_linked_list settings_update_element;
+	struct zms_batch_entry batch[4];
+	size_t batch_len = 0;
+	size_t ll_update_idx = 0;
 	char rdname[SETTINGS_FULL_NAME_LEN];
 	uint32_t name_hash;
 	uint32_t collision_num = 0;
 	bool delete;
 	bool write_name;
 	bool hash_collision;
+	bool ll_update = false;
 	int rc = 0;
 	int first_available_hash_index = -1;
 	size_t name_len;
@@ -488,70 +509,99 @@ no_hash_collision:
 		return rc;
 	}
 
-	/* write the value */
-	rc = zms_write(&cf->cf_zms, ZMS_DATA_ID_FROM_NAME(name_hash), value, val_len);
-	if (rc < 0) {
-		return rc;
+	if (!write_name) {
+		/* only the value changes */
+		rc = zms_write(&cf->cf_zms, ZMS_DATA_ID_FROM_NAME(name_hash), value, val_len);
+		if (rc < 0) {
+			return rc;
+		}
+		return 0;
 	}
 
-	/* write the name if required */
-	if (write_name) {
-		/* First let's update the linked list */
+	/* For a new name, the value, the linked list update and the name are
+	 * written as one batch, a power loss cannot leave a partial entry.
+	 */
+	batch[batch_len++] = (struct zms_batch_entry){
+		.id = ZMS_DATA_ID_FROM_NAME(name_hash),
+		.data = value,
+		.len = val_len,
+	};
+
 #ifdef CONFIG_SETTINGS_ZMS_NO_LL_DELETE
-		/* verify that the ll_node doesn't exist otherwise do not update it */
-		rc = zms_read(&cf->cf_zms, ZMS_LL_NODE_FROM_NAME_ID(name_hash), &settings_element,
-			      sizeof(struct settings_hash_linked_list));
-		if (rc >= 0) {
-			goto no_ll_update;
-		} else if (rc != -ENOENT) {
-			return rc;
-		}
-		/* else the LL node doesn't exist let's update it */
+	/* verify that the ll_node doesn't exist otherwise do not update it */
+	rc = zms_read(&cf->cf_zms, ZMS_LL_NODE_FROM_NAME_ID(name_hash), &settings_element,
+		      sizeof(struct settings_hash_linked_list));
+	if (rc >= 0) {
+		goto no_ll_update;
+	} else if (rc != -ENOENT) {
+		return rc;
+	}
+	/* else the LL node doesn't exist let's update it */
 #endif /* CONFIG_SETTINGS_ZMS_NO_LL_DELETE */
-		/* write linked list structure element */
-		settings_element.next_hash = 0;
-		/* Verify first that the linked list last element is not broken.
-		 * Settings subsystem uses ID that starts from ZMS_LL_HEAD_HASH_ID.
-		 */
-		if (cf->last_hash_id < ZMS_LL_HEAD_HASH_ID) {
-			LOG_WRN("Linked list for hashes is broken, Trying to recover");
-			rc = settings_zms_get_last_hash_ids(cf);
-			if (rc < 0) {
-				return rc;
-			}
-		}
-		settings_element.previous_hash = cf->last_hash_id;
-		rc = zms_write(&cf->cf_zms, ZMS_LL_NODE_FROM_NAME_ID(name_hash), &settings_element,
-			       sizeof(struct settings_hash_linked_list));
+	/* write linked list structure element */
+	settings_element.next_hash = 0;
+	/* Verify first that the linked list last element is not broken.
+	 * Settings subsystem uses ID that starts from ZMS_LL_HEAD_HASH_ID.
+	 */
+	if (cf->last_hash_id < ZMS_LL_HEAD_HASH_ID) {
+		LOG_WRN("Linked list for hashes is broken, Trying to recover");
+		rc = settings_zms_get_last_hash_ids(cf);
 		if (rc < 0) {
 			return rc;
 		}
+	}
+	settings_element.previous_hash = cf->last_hash_id;
+	batch[batch_len++] = (struct zms_batch_entry){
+		.id = ZMS_LL_NODE_FROM_NAME_ID(name_hash),
+		.data = &settings_element,
+		.len = sizeof(struct settings_hash_linked_list),
+	};
+
+	/* Now update the previous linked list element */
+	settings_update_element.next_hash = ZMS_LL_NODE_FROM_NAME_ID(name_hash);
+	settings_update_element.previous_hash = cf->second_to_last_hash_id;
+	batch[batch_len++] = (struct zms_batch_entry){
+		.id = cf->last_hash_id,
+		.data = &settings_update_element,
+		.len = sizeof(struct settings_hash_linked_list),
+	};
+	ll_update_idx = batch_len - 1;
+	ll_update = true;
 
-		/* Now update the previous linked list element */
-		settings_element.next_hash = ZMS_LL_NODE_FROM_NAME_ID(name_hash);
-		settings_element.previous_hash = cf->second_to_last_hash_id;
-		rc = zms_write(&cf->cf_zms, cf->last_hash_id, &settings_element,
-			       sizeof(struct settings_hash_linked_list));
+#ifdef CONFIG_SETTINGS_ZMS_NO_LL_DELETE
+no_ll_update:
+#endif /* CONFIG_SETTINGS_ZMS_NO_LL_DELETE */
+	/* Now let's write the name */
+	batch[batch_len++] = (struct zms_batch_entry){
+		.id = name_hash,
+		.data = name,
+		.len = name_len,
+	};
+
+	if (zms_batch_fits(&cf->cf_zms, batch, batch_len)) {
+		rc = zms_write_batch(&cf->cf_zms, batch, batch_len);
 		if (rc < 0) {
 			return rc;
 		}
-		cf->second_to_last_hash_id = cf->last_hash_id;
-		cf->last_hash_id = ZMS_LL_NODE_FROM_NAME_ID(name_hash);
-#ifdef CONFIG_SETTINGS_ZMS_LL_CACHE
-		if (cf->ll_cache_next < CONFIG_SETTINGS_ZMS_LL_CACHE_SIZE) {
-			cf->ll_cache[cf->ll_cache_next] = settings_element;
-			cf->ll_cache_next = cf->ll_cache_next + 1;
+
+		if (ll_update) {
+			settings_zms_ll_append(cf, name_hash, &settings_update_element);
 		}
-#endif
-#ifdef CONFIG_SETTINGS_ZMS_NO_LL_DELETE
-no_ll_update:
-#endif /* CONFIG_SETTINGS_ZMS_NO_LL_DELETE */
-		/* Now let's write the name */
-		rc = zms_write(&cf->cf_zms, name_hash, name, name_len);
+		return 0;
+	}
+
+	/* A batch must fit into one sector, larger values are written entry by entry */
+	for (size_t i = 0; i < batch_len; i++) {
+		rc = zms_write(&cf->cf_zms, batch[i].id, batch[i].data, batch[i].len);
 		if (rc < 0) {
 			return rc;
 		}
+
+		if (ll_update && (i == ll_update_idx)) {
+			settings_zms_ll_append(cf, name_hash, &settings_update_element);
+		}
 	}
+
 	return 0;
 }
 
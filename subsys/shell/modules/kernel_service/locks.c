@@ -0,0 +1,61 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "kernel_shell.h"
+
+#include <inttypes.h>
+#include <zephyr/kernel.h>
+
+static int lock_stats_dump(struct k_obj_core *obj_core, void *user_data)
+{
+	const struct shell *sh = (const struct shell *)user_data;
+	struct k_lock_stats stats;
+	const char *holder;
+
+	if (k_obj_core_stats_raw(obj_core, &stats, sizeof(stats)) != 0) {
+		return 0;
+	}
+
+	if (stats.acquired == 0U && stats.contended == 0U) {
+		return 0;
+	}
+
+	holder = (stats.holder != NULL) ? k_thread_name_get(stats.holder) : NULL;
+
+	shell_print(sh, "%-10s %p %10u %10u %12" PRIu64 " %12u  %p %s",
+		    (obj_core->type->id == K_OBJ_TYPE_MUTEX_ID) ? "mutex" : "sem",
+		    (void *)((char *)obj_core - obj_core->type->obj_core_offset),
+		    stats.acquired, stats.contended, stats.wait_cycles,
+		    stats.max_wait_cycles, stats.holder, holder ? holder : "");
+
+	return 0;
+}
+
+static int cmd_kernel_locks(const struct shell *sh, size_t argc, char **argv)
+{
+	static const uint32_t type_ids[] = {
+		IF_ENABLED(CONFIG_OBJ_CORE_STATS_MUTEX, (K_OBJ_TYPE_MUTEX_ID,))
+		IF_ENABLED(CONFIG_OBJ_CORE_STATS_SEM, (K_OBJ_TYPE_SEM_ID,))
+	};
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(sh, "%-10s %-10s %10s %10s %12s %12s  %s", "type", "object", "acquired",
+		    "contended", "wait cycles", "max wait", "holder");
+
+	for (size_t i = 0; i < ARRAY_SIZE(type_ids); i++) {
+		struct k_obj_type *type = k_obj_type_find(type_ids[i]);
+
+		if (type != NULL) {
+			k_obj_type_walk_unlocked(type, lock_stats_dump, (void *)sh);
+		}
+	}
+
+	return 0;
+}
+
+KERNEL_CMD_ADD(locks, NULL, "Mutex and semaphore contention statistics.", cmd_kernel_locks);
@@ -10,6 +10,34 @@
 #include <zephyr/drivers/timer/system_timer.h>
 #include <zephyr/kernel.h>
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+/* Returns the upper bound (in cycles) of the histogram bucket in which the
+ * given per mille of the samples is reached.
+ */
+static uint32_t latency_percentile(const uint32_t *hist, uint32_t per_mille)
+{
+	uint64_t total = 0;
+	uint64_t seen = 0;
+
+	for (size_t i = 0; i < CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS; i++) {
+		total += hist[i];
+	}
+
+	if (total == 0U) {
+		return 0;
+	}
+
+	for (size_t i = 0; i < CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS; i++) {
+		seen += hist[i];
+		if ((seen * 1000U) >= (total * per_mille)) {
+			return (i < 32) ? BIT(i) : UINT32_MAX;
+		}
+	}
+
+	return 0;
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+
 #ifdef CONFIG_THREAD_RUNTIME_STATS
 static void rt_stats_dump(const struct shell *sh, struct k_thread *thread)
 {
@@ -48,6 +76,12 @@ static void rt_stats_dump(const struct shell *sh, struct k_thread *thread)
 		shell_print(sh, "\tAverage execution cycles: %u",
 			    (uint32_t)rt_stats_thread.average_cycles);
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+		shell_print(sh, "\tScheduling latency cycles: p50 < %u, p99 < %u, p99.9 < %u",
+			    latency_percentile(rt_stats_thread.latency, 500U),
+			    latency_percentile(rt_stats_thread.latency, 990U),
+			    latency_percentile(rt_stats_thread.latency, 999U));
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
 	} else {
 		shell_print(sh, "\tTotal execution cycles: ? (? %%)");
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
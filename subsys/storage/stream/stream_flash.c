@@ -85,6 +85,10 @@ static int stream_flash_erase_to_append(struct stream_flash_ctx *ctx, size_t siz
 	int rc = 0;
 #if defined(CONFIG_STREAM_FLASH_ERASE)
 	struct flash_pages_info page;
+	off_t erase_start;
+	off_t erase_limit;
+	size_t erase_size;
+	size_t erase_end;
 #if defined(CONFIG_STREAM_FLASH_ERASE_ONLY_WHEN_SUPPORTED)
 	const struct flash_parameters *fparams = flash_get_parameters(ctx->fdev);
 #endif
@@ -116,14 +120,46 @@ static int stream_flash_erase_to_append(struct stream_flash_ctx *ctx, size_t siz
 		return rc;
 	}
 
-	LOG_DBG("Erasing page at offset 0x%08lx", (long)page.start_offset);
+	erase_start = page.start_offset;
+	erase_size = page.size;
 
-	rc = flash_erase(ctx->fdev, page.start_offset, page.size);
+#if CONFIG_STREAM_FLASH_ERASE_AHEAD_SIZE > 0
+	/* Erase-ahead must not go past the page holding the last usable byte */
+	rc = flash_get_page_info_by_offs(ctx->fdev, ctx->offset + ctx->available - 1, &page);
+	if (rc != 0) {
+		LOG_ERR("Error %d while getting page info", rc);
+		return rc;
+	}
+
+	erase_limit = page.start_offset + page.size;
+#else
+	erase_limit = ctx->offset + ctx->available;
+#endif
+
+	/* Extend the erase over the pages within CONFIG_STREAM_FLASH_ERASE_AHEAD_SIZE
+	 * bytes past the data to append, so that they are erased with a single
+	 * call, which devices with large erase blocks can execute faster.
+	 */
+	erase_end = MIN(ctx->bytes_written + size + CONFIG_STREAM_FLASH_ERASE_AHEAD_SIZE,
+			ctx->available);
+	while ((erase_start + erase_size < ctx->offset + erase_end) &&
+	       (erase_start + erase_size < erase_limit)) {
+		rc = flash_get_page_info_by_offs(ctx->fdev, erase_start + erase_size, &page);
+		if (rc != 0) {
+			LOG_ERR("Error %d while getting page info", rc);
+			return rc;
+		}
+		erase_size += page.size;
+	}
+
+	LOG_DBG("Erasing 0x%zx bytes at offset 0x%08lx", erase_size, (long)erase_start);
+
+	rc = flash_erase(ctx->fdev, erase_start, erase_size);
 
 	if (rc != 0) {
 		LOG_ERR("Error %d while erasing page", rc);
 	} else {
-		ctx->erased_up_to += page.size;
+		ctx->erased_up_to = erase_start + erase_size - ctx->offset;
 	}
 #endif
 	return rc;
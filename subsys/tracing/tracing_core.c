@@ -40,6 +40,13 @@ static K_SEM_DEFINE(tracing_thread_sem, 0, 1);
 static K_THREAD_STACK_DEFINE(tracing_thread_stack,
 			CONFIG_TRACING_THREAD_STACK_SIZE);
 
+#if CONFIG_TRACING_BUFFER_FLUSH_WATERMARK > 0
+/* Set once the buffer went above the watermark and the tracing thread was
+ * woken up early, cleared when the tracing thread drained the buffer.
+ */
+static atomic_t tracing_thread_kicked;
+#endif
+
 static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 {
 	uint8_t *transferring_buf;
@@ -51,6 +58,9 @@ static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 
 	while (true) {
 		if (tracing_buffer_is_empty()) {
+#if CONFIG_TRACING_BUFFER_FLUSH_WATERMARK > 0
+			atomic_clear(&tracing_thread_kicked);
+#endif
 			k_sem_take(&tracing_thread_sem, K_FOREVER);
 		} else {
 			transferring_length =
@@ -114,7 +124,21 @@ void tracing_trigger_output(bool before_put_is_empty)
 		k_timer_start(&tracing_thread_timer,
 			      K_MSEC(CONFIG_TRACING_THREAD_WAIT_THRESHOLD),
 			      K_NO_WAIT);
+		return;
 	}
+
+#if CONFIG_TRACING_BUFFER_FLUSH_WATERMARK > 0
+	/* Do not wait for the threshold to expire when the buffer is filling
+	 * up, packets would be dropped. The timer is used instead of giving
+	 * the semaphore directly as this may be called from within the
+	 * scheduler.
+	 */
+	if ((tracing_buffer_space_get() * 100U) <
+	    (tracing_buffer_capacity_get() * (100U - CONFIG_TRACING_BUFFER_FLUSH_WATERMARK)) &&
+	    atomic_cas(&tracing_thread_kicked, 0, 1)) {
+		k_timer_start(&tracing_thread_timer, K_NO_WAIT, K_NO_WAIT);
+	}
+#endif
 }
 
 bool is_tracing_thread(void)
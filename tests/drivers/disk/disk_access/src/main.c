@@ -338,6 +338,110 @@ ZTEST(disk_driver, test_write)
 	}
 }
 
+/* Test single sector writes read back as one multi-sector read, before and
+ * after the disk is synchronized. This exercises write-back and read-ahead
+ * when the disk access block cache is enabled.
+ * WARNING: this test is destructive- it will overwrite data on the disk!
+ */
+ZTEST(disk_driver, test_write_sync)
+{
+	uint8_t *wbuf = scratch_buf[0];
+	uint8_t *rbuf = scratch_buf[1];
+	int rc, i;
+
+	for (i = 0; i < SECTOR_COUNT1 * disk_sector_size; i++) {
+		wbuf[i] = (uint8_t)(i ^ (i / disk_sector_size));
+	}
+
+	/* Write odd sectors first, then even ones */
+	for (i = 1; i < SECTOR_COUNT1; i += 2) {
+		rc = disk_access_write(disk_pdrv, &wbuf[i * disk_sector_size], i, 1);
+		zassert_equal(rc, 0, "Failed to write sector %d", i);
+	}
+	for (i = 0; i < SECTOR_COUNT1; i += 2) {
+		rc = disk_access_write(disk_pdrv, &wbuf[i * disk_sector_size], i, 1);
+		zassert_equal(rc, 0, "Failed to write sector %d", i);
+	}
+
+	memset(rbuf, 0, SECTOR_COUNT1 * disk_sector_size);
+	rc = read_sector(rbuf, 0, SECTOR_COUNT1);
+	zassert_equal(rc, 0, "Failed to read from disk");
+	zassert_mem_equal(wbuf, rbuf, SECTOR_COUNT1 * disk_sector_size,
+			  "Read data did not match data written to disk");
+
+	rc = disk_access_ioctl(disk_pdrv, DISK_IOCTL_CTRL_SYNC, NULL);
+	zassert_equal(rc, 0, "Failed to synchronize disk");
+
+	/* Sequential single sector reads */
+	memset(rbuf, 0, SECTOR_COUNT1 * disk_sector_size);
+	for (i = 0; i < SECTOR_COUNT1; i++) {
+		rc = read_sector(&rbuf[i * disk_sector_size], i, 1);
+		zassert_equal(rc, 0, "Failed to read sector %d", i);
+	}
+	zassert_mem_equal(wbuf, rbuf, SECTOR_COUNT1 * disk_sector_size,
+			  "Read data did not match data written to disk");
+}
+
+#ifdef CONFIG_DISK_ACCESS_CACHE_WRITE_BACK
+/* Test read-ahead into a cache full of dirty sectors. Storing the read-ahead
+ * sectors evicts dirty ones, whose write back must not clobber the data read.
+ * WARNING: this test is destructive- it will overwrite data on the disk!
+ */
+ZTEST(disk_driver, test_cache_read_ahead)
+{
+	const uint32_t dirty_count = CONFIG_DISK_ACCESS_CACHE_BLOCKS;
+	const uint32_t read_start = dirty_count + CONFIG_DISK_ACCESS_CACHE_XFER_SECTORS;
+	uint8_t *wbuf = scratch_buf[0];
+	uint8_t *rbuf = scratch_buf[1];
+	uint8_t *dirty_buf = &wbuf[SECTOR_COUNT1 * disk_sector_size];
+	int rc, i;
+
+	if ((disk_sector_size != CONFIG_DISK_ACCESS_CACHE_SECTOR_SIZE) ||
+	    (read_start + SECTOR_COUNT1 > disk_sector_count)) {
+		ztest_test_skip();
+	}
+
+	/* Sectors to read ahead, written past the cache */
+	for (i = 0; i < SECTOR_COUNT1 * disk_sector_size; i++) {
+		wbuf[i] = (uint8_t)(i ^ (i / disk_sector_size));
+	}
+	rc = disk_access_write(disk_pdrv, wbuf, read_start, SECTOR_COUNT1);
+	zassert_equal(rc, 0, "Failed to write to disk");
+
+	/* Fill the whole cache with dirty sectors */
+	memset(dirty_buf, 0xa5, disk_sector_size);
+	for (i = 0; i < dirty_count; i++) {
+		rc = disk_access_write(disk_pdrv, dirty_buf, i, 1);
+		zassert_equal(rc, 0, "Failed to write sector %d", i);
+	}
+
+	/* Sequential single sector reads, then the same sectors from the cache */
+	memset(rbuf, 0, SECTOR_COUNT1 * disk_sector_size);
+	for (i = 0; i < SECTOR_COUNT1; i++) {
+		rc = read_sector(&rbuf[i * disk_sector_size], read_start + i, 1);
+		zassert_equal(rc, 0, "Failed to read sector %d", read_start + i);
+	}
+	zassert_mem_equal(wbuf, rbuf, SECTOR_COUNT1 * disk_sector_size,
+			  "Read data did not match data written to disk");
+
+	for (i = 0; i < SECTOR_COUNT1; i++) {
+		memset(rbuf, 0, disk_sector_size);
+		rc = read_sector(rbuf, read_start + i, 1);
+		zassert_equal(rc, 0, "Failed to read sector %d", read_start + i);
+		zassert_mem_equal(&wbuf[i * disk_sector_size], rbuf, disk_sector_size,
+				  "Cached sector %d does not match the disk", read_start + i);
+	}
+
+	/* The evicted sectors reached the disk */
+	rc = disk_access_ioctl(disk_pdrv, DISK_IOCTL_CTRL_SYNC, NULL);
+	zassert_equal(rc, 0, "Failed to synchronize disk");
+	rc = read_sector(rbuf, 0, 1);
+	zassert_equal(rc, 0, "Failed to read sector 0");
+	zassert_mem_equal(dirty_buf, rbuf, disk_sector_size,
+			  "Written back sector does not match");
+}
+#endif /* CONFIG_DISK_ACCESS_CACHE_WRITE_BACK */
+
 /* Test multiple erases in series, and erasing from a variety of blocks */
 ZTEST(disk_driver, test_erase)
 {
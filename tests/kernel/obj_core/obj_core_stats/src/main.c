@@ -693,6 +693,56 @@ ZTEST(obj_core_stats_mem_slab, test_obj_core_stats_mem_slab)
 	k_mem_slab_free(&mem_slab, mem2);
 }
 
+/***************** MUTEXES AND SEMAPHORES ******************/
+
+K_MUTEX_DEFINE(stats_mutex);
+K_SEM_DEFINE(stats_sem, 0, 1);
+
+ZTEST(obj_core_stats_lock, test_obj_core_stats_mutex)
+{
+	struct k_lock_stats stats;
+	int  status;
+
+	k_mutex_lock(&stats_mutex, K_FOREVER);
+	k_mutex_lock(&stats_mutex, K_FOREVER);
+	k_mutex_unlock(&stats_mutex);
+	k_mutex_unlock(&stats_mutex);
+
+	status = k_obj_core_stats_raw(K_OBJ_CORE(&stats_mutex), &stats, sizeof(stats));
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+	zassert_equal(stats.acquired, 2, "Expected 2 acquisitions, got %u", stats.acquired);
+	zassert_equal(stats.contended, 0, "Expected no contention, got %u", stats.contended);
+	zassert_equal(stats.holder, k_current_get(), "Unexpected holder %p", stats.holder);
+
+	status = k_obj_core_stats_reset(K_OBJ_CORE(&stats_mutex));
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+
+	status = k_obj_core_stats_raw(K_OBJ_CORE(&stats_mutex), &stats, sizeof(stats));
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+	zassert_equal(stats.acquired, 0, "Expected 0 acquisitions, got %u", stats.acquired);
+}
+
+ZTEST(obj_core_stats_lock, test_obj_core_stats_sem)
+{
+	struct k_lock_stats stats;
+	int  status;
+
+	/* Semaphore is not available, the take has to wait and time out */
+	status = k_sem_take(&stats_sem, K_MSEC(1));
+	zassert_equal(status, -EAGAIN, "Expected -EAGAIN, got %d\n", status);
+
+	k_sem_give(&stats_sem);
+	status = k_sem_take(&stats_sem, K_NO_WAIT);
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+
+	status = k_obj_core_stats_raw(K_OBJ_CORE(&stats_sem), &stats, sizeof(stats));
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+	zassert_equal(stats.acquired, 1, "Expected 1 acquisition, got %u", stats.acquired);
+	zassert_equal(stats.contended, 1, "Expected 1 wait, got %u", stats.contended);
+	zassert_true(stats.max_wait_cycles > 0, "Expected a non-zero wait");
+	zassert_equal(stats.wait_cycles, stats.max_wait_cycles, "Unexpected wait cycles");
+}
+
 ZTEST_SUITE(obj_core_stats_system, NULL, NULL,
 	    ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
 
@@ -704,3 +754,6 @@ ZTEST_SUITE(obj_core_stats_mem_block, NULL, NULL,
 
 ZTEST_SUITE(obj_core_stats_mem_slab, NULL, NULL,
 	    ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
+
+ZTEST_SUITE(obj_core_stats_lock, NULL, NULL,
+	    ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
@@ -554,5 +554,49 @@ ZTEST(usage_api, test_thread_stats_usage)
 	k_thread_abort(tid);
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+static uint32_t latency_samples(const k_thread_runtime_stats_t *stats)
+{
+	uint32_t sum = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(stats->latency); i++) {
+		sum += stats->latency[i];
+	}
+
+	return sum;
+}
+#endif
+
+/**
+ * @brief Test the scheduling latency histogram
+ *
+ * Every wake up of the main thread from a timeout must be recorded in both
+ * its own and the CPU scheduling latency histograms.
+ */
+ZTEST(usage_api, test_thread_stats_latency)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_SCHED_THREAD_USAGE_LATENCY);
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	k_thread_runtime_stats_t  thread_stats1;
+	k_thread_runtime_stats_t  thread_stats2;
+	k_thread_runtime_stats_t  cpu_stats1;
+	k_thread_runtime_stats_t  cpu_stats2;
+
+	k_thread_runtime_stats_get(_current, &thread_stats1);
+	k_thread_runtime_stats_cpu_get(0, &cpu_stats1);
+
+	for (int i = 0; i < 3; i++) {
+		k_sleep(K_TICKS(1));
+	}
+
+	k_thread_runtime_stats_get(_current, &thread_stats2);
+	k_thread_runtime_stats_cpu_get(0, &cpu_stats2);
+
+	zassert_equal(latency_samples(&thread_stats2) - latency_samples(&thread_stats1), 3);
+	zassert_true(latency_samples(&cpu_stats2) - latency_samples(&cpu_stats1) >= 3);
+#endif
+}
+
 ZTEST_SUITE(usage_api, NULL, NULL,
 		ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
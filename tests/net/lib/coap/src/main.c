@@ -817,6 +817,101 @@ ZTEST(coap, test_retransmit_second_round)
 	zassert_is_null(rsp_pending, "There should be no active pendings");
 }
 
+static void pending_expired_cb(struct coap_pending *pending, bool retransmit, void *user_data)
+{
+	size_t *count = user_data;
+
+	if (!retransmit) {
+		coap_pending_clear(pending);
+	}
+
+	(*count)++;
+}
+
+ZTEST(coap, test_pending_queue_expire)
+{
+	static struct coap_pending queue_pendings[4];
+	static uint8_t by_id[ARRAY_SIZE(queue_pendings)];
+	static uint8_t by_expiry[ARRAY_SIZE(queue_pendings)];
+	static const uint16_t ids[] = { 40, 10, 30, 20 };
+	struct coap_pending_queue queue;
+	struct coap_transmission_parameters params = coap_get_transmission_parameters();
+	struct coap_packet cpkt;
+	struct coap_packet rsp;
+	struct coap_pending *pending;
+	size_t count = 0;
+	int r;
+
+	params.ack_timeout = 100;
+	params.ack_random_percent = 100;
+	params.max_retransmission = 1;
+
+	memset(queue_pendings, 0, sizeof(queue_pendings));
+	coap_pending_queue_init(&queue, queue_pendings, by_id, by_expiry,
+				ARRAY_SIZE(queue_pendings));
+
+	for (size_t i = 0; i < ARRAY_SIZE(ids); i++) {
+		r = coap_packet_init(&cpkt, data_buf[0], COAP_BUF_SIZE, COAP_VERSION_1,
+				     COAP_TYPE_CON, 0, NULL, COAP_METHOD_GET, ids[i]);
+		zassert_equal(r, 0, "Could not initialize packet");
+
+		r = coap_pending_init(&queue_pendings[i], &cpkt,
+				      (struct net_sockaddr *)&dummy_addr, &params);
+		zassert_equal(r, 0, "Could not initialize pending");
+
+		zassert_true(coap_pending_cycle(&queue_pendings[i]), "Pending expired too early");
+
+		/* The last pending request expires later than the others */
+		queue_pendings[i].t0 = (i == ARRAY_SIZE(ids) - 1) ? 1000 : 10 * i;
+
+		r = coap_pending_queue_add(&queue, &queue_pendings[i]);
+		zassert_equal(r, 0, "Could not queue pending");
+	}
+
+	zassert_equal(coap_pending_queue_add(&queue, &queue_pendings[0]), -ENOMEM,
+		      "Queue should be full");
+	zassert_equal_ptr(coap_pending_queue_next_to_expire(&queue), &queue_pendings[0],
+			  "Invalid next pending to expire");
+
+	/* Nothing expired yet */
+	zassert_equal(coap_pending_queue_expire(&queue, 99, pending_expired_cb, &count), 0);
+	zassert_equal(count, 0, "No pending should have expired");
+
+	/* Three pending requests expire in a single pass and are requeued */
+	zassert_equal(coap_pending_queue_expire(&queue, 500, pending_expired_cb, &count), 3);
+	zassert_equal(count, 3, "Expired pendings were not all handled");
+	zassert_equal(queue.count, 4, "Retransmitted pendings should stay queued");
+
+	for (size_t i = 0; i < ARRAY_SIZE(ids) - 1; i++) {
+		zassert_equal(queue_pendings[i].timeout, 200, "Timeout was not backed off");
+		zassert_equal(queue_pendings[i].retries, 0, "Retries were not decremented");
+	}
+
+	zassert_equal_ptr(coap_pending_queue_next_to_expire(&queue), &queue_pendings[0],
+			  "Invalid next pending to expire");
+
+	/* Responses are matched by message ID */
+	r = coap_packet_init(&rsp, data_buf[1], COAP_BUF_SIZE, COAP_VERSION_1,
+			     COAP_TYPE_ACK, 0, NULL, COAP_METHOD_GET, 30);
+	zassert_equal(r, 0, "Could not initialize packet");
+
+	pending = coap_pending_queue_received(&queue, &rsp);
+	zassert_equal_ptr(pending, &queue_pendings[2], "Invalid pending for response");
+
+	coap_pending_queue_remove(&queue, pending);
+	coap_pending_clear(pending);
+	zassert_is_null(coap_pending_queue_received(&queue, &rsp), "Pending should be removed");
+	zassert_equal(queue.count, 3, "Pending should be removed");
+
+	/* No retransmission is left for the two remaining early ones */
+	count = 0;
+	zassert_equal(coap_pending_queue_expire(&queue, 1000, pending_expired_cb, &count), 2);
+	zassert_equal(count, 2, "Expired pendings were not all handled");
+	zassert_equal(queue.count, 1, "Exhausted pendings should be removed");
+	zassert_equal_ptr(coap_pending_queue_next_to_expire(&queue), &queue_pendings[3],
+			  "Invalid next pending to expire");
+}
+
 static bool ipaddr_cmp(const struct net_sockaddr *a, const struct net_sockaddr *b)
 {
 	if (a->sa_family != b->sa_family) {
@@ -267,3 +267,27 @@ ZTEST(net_dns_cache_test, test_remove_null_parameters)
 	zassert_equal(-EINVAL, dns_cache_remove(&test_dns_cache, NULL),
 		      "NULL query should return error.");
 }
+
+ZTEST(net_dns_cache_test, test_negative_entry)
+{
+	struct dns_addrinfo info_read = {0};
+	const char *query = "nonexistent.example.com";
+
+	zassert_ok(dns_cache_add_negative(&test_dns_cache, query, DNS_QUERY_TYPE_A,
+					  TEST_DNS_CACHE_DEFAULT_TTL),
+		   "Negative cache entry adding should work.");
+	zassert_equal(-ENOENT,
+		      dns_cache_find(&test_dns_cache, query, DNS_QUERY_TYPE_A, &info_read, 1));
+	zassert_equal(0, info_read.ai_family);
+	zassert_equal(0,
+		      dns_cache_find(&test_dns_cache, query, DNS_QUERY_TYPE_AAAA, &info_read, 1));
+	k_sleep(K_MSEC(TEST_DNS_CACHE_DEFAULT_TTL * 1000 + 1));
+	zassert_equal(0, dns_cache_find(&test_dns_cache, query, DNS_QUERY_TYPE_A, &info_read, 1));
+}
+
+ZTEST(net_dns_cache_test, test_negative_entry_invalid_type)
+{
+	zassert_equal(-EINVAL, dns_cache_add_negative(&test_dns_cache, "example.com",
+						      DNS_QUERY_TYPE_PTR,
+						      TEST_DNS_CACHE_DEFAULT_TTL));
+}
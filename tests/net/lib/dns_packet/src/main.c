@@ -1265,6 +1265,81 @@ ZTEST(dns_packet, test_dns_flags_len)
 		      "DNS message length check failed (%d)", ret);
 }
 
+static uint8_t resp_name_error_ipv4[] = {
+	/* DNS msg header (12 bytes), rcode is name error (NXDOMAIN) */
+	0xb0, 0x42, 0x81, 0x83, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00,
+
+	/* Query string (www.zephyrproject.org) */
+	0x03, 0x77, 0x77, 0x77, 0x0d, 0x7a, 0x65, 0x70,
+	0x68, 0x79, 0x72, 0x70, 0x72, 0x6f, 0x6a, 0x65,
+	0x63, 0x74, 0x03, 0x6f, 0x72, 0x67, 0x00,
+
+	/* Query type */
+	0x00, 0x01,
+
+	/* Query class */
+	0x00, 0x01,
+};
+
+static enum dns_resolve_status name_error_status;
+static int name_error_cb_count;
+
+static void name_error_cb(enum dns_resolve_status status,
+			  struct dns_addrinfo *info,
+			  void *user_data)
+{
+	ARG_UNUSED(info);
+	ARG_UNUSED(user_data);
+
+	name_error_status = status;
+	name_error_cb_count++;
+}
+
+ZTEST(dns_packet, test_dns_name_error)
+{
+	static const uint8_t query[] = {
+		/* Labels */
+		0x03, 0x77, 0x77, 0x77, 0x0d, 0x7a, 0x65, 0x70,
+		0x68, 0x79, 0x72, 0x70, 0x72, 0x6f, 0x6a, 0x65,
+		0x63, 0x74, 0x03, 0x6f, 0x72, 0x67, 0x00,
+		/* Query type */
+		0x00, 0x01
+	};
+	struct dns_msg_t dns_msg = { 0 };
+	uint16_t dns_id = 0;
+	int query_idx = -1;
+	uint16_t query_hash = 0;
+	int ret;
+
+	dns_msg.msg = resp_name_error_ipv4;
+	dns_msg.msg_size = sizeof(resp_name_error_ipv4);
+
+	dns_id = dns_unpack_header_id(dns_msg.msg);
+
+	setup_dns_context(&dns_ctx, 0, dns_id, query, sizeof(query),
+			  DNS_QUERY_TYPE_A);
+	dns_ctx.queries[0].query = "www.zephyrproject.org";
+
+	/* A name error fails the query whether negative caching is enabled or not */
+	ret = dns_validate_msg(&dns_ctx, &dns_msg, &dns_id, &query_idx,
+			       NULL, &query_hash);
+	zassert_equal(ret, DNS_EAI_FAIL, "Name error not reported (%d)", ret);
+
+#if defined(CONFIG_DNS_RESOLVER_CACHE) && CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL > 0
+	zassert_equal(query_idx, 0, "Query not matched (%d)", query_idx);
+
+	/* The next query for the name fails from the negative cache entry */
+	name_error_cb_count = 0;
+	ret = dns_resolve_name(&dns_ctx, "www.zephyrproject.org", DNS_QUERY_TYPE_A,
+			       &dns_id, name_error_cb, NULL, 1000);
+	zassert_equal(ret, 0, "Cannot resolve name (%d)", ret);
+	zassert_equal(name_error_cb_count, 1, "Callback not called from the cache");
+	zassert_equal(name_error_status, DNS_EAI_FAIL, "Invalid status (%d)",
+		      name_error_status);
+#endif
+}
+
 static uint8_t invalid_answer_resp_ipv4[18] = {
 	/* DNS msg header (12 bytes) */
 	0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
@@ -257,6 +257,45 @@ ZTEST(lwm2m_engine, test_check_notifications)
 		      "Next observe event not scheduled");
 }
 
+ZTEST(lwm2m_engine, test_check_notifications_coalesced)
+{
+	int ret;
+	struct lwm2m_ctx ctx;
+	struct observe_node obs_due;
+	struct observe_node obs_pmax;
+
+	(void)memset(&ctx, 0x0, sizeof(ctx));
+
+	ctx.sock_fd = -1;
+	ctx.load_credentials = NULL;
+	ctx.remote_addr.sa_family = NET_AF_INET;
+	sys_slist_init(&ctx.observer);
+
+	obs_due.last_timestamp = k_uptime_get();
+	obs_due.event_timestamp = k_uptime_get() + 1000U;
+	obs_due.resource_update = false;
+	obs_due.active_notify = NULL;
+
+	/* Expires within the coalescing window of the first notification */
+	obs_pmax.last_timestamp = k_uptime_get();
+	obs_pmax.event_timestamp = k_uptime_get() + 4000U;
+	obs_pmax.resource_update = false;
+	obs_pmax.active_notify = NULL;
+
+	sys_slist_append(&ctx.observer, &obs_due.node);
+	sys_slist_append(&ctx.observer, &obs_pmax.node);
+
+	lwm2m_rd_client_is_registred_fake.return_val = true;
+	ret = lwm2m_engine_start(&ctx);
+	zassert_equal(ret, 0);
+	/* wait for socket receive thread */
+	k_sleep(K_MSEC(2000));
+	ret = lwm2m_engine_stop(&ctx);
+	zassert_equal(ret, 0);
+	zassert_equal(generate_notify_message_fake.call_count, 2,
+		      "Notify messages not coalesced");
+}
+
 ZTEST(lwm2m_engine, test_push_queued_buffers)
 {
 	int ret;
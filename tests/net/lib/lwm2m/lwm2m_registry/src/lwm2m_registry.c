@@ -571,6 +571,34 @@ ZTEST(lwm2m_registry, test_next_engine_obj_inst)
 	zassert_is_null(lwm2m_engine_get_obj_inst(&LWM2M_OBJ(3303, 1)));
 }
 
+ZTEST(lwm2m_registry, test_next_engine_obj_inst_unordered)
+{
+	struct lwm2m_engine_obj_inst *oi;
+	uint16_t expected = 0;
+
+	zassert_equal(lwm2m_create_object_inst(&LWM2M_OBJ(3303, 2)), 0);
+	zassert_equal(lwm2m_create_object_inst(&LWM2M_OBJ(3303, 0)), 0);
+	zassert_equal(lwm2m_create_object_inst(&LWM2M_OBJ(3303, 1)), 0);
+
+	for (oi = next_engine_obj_inst(3303, -1); oi != NULL;
+	     oi = next_engine_obj_inst(3303, oi->obj_inst_id)) {
+		zassert_equal(oi->obj->obj_id, 3303);
+		zassert_equal(oi->obj_inst_id, expected);
+		expected++;
+	}
+	zassert_equal(expected, 3);
+
+	zassert_equal(lwm2m_delete_object_inst(&LWM2M_OBJ(3303, 1)), 0);
+	zassert_is_null(lwm2m_engine_get_obj_inst(&LWM2M_OBJ(3303, 1)));
+	oi = next_engine_obj_inst(3303, 0);
+	zassert_not_null(oi);
+	zassert_equal(oi->obj_inst_id, 2);
+
+	zassert_equal(lwm2m_delete_object_inst(&LWM2M_OBJ(3303, 0)), 0);
+	zassert_equal(lwm2m_delete_object_inst(&LWM2M_OBJ(3303, 2)), 0);
+	zassert_is_null(next_engine_obj_inst(3303, -1));
+}
+
 ZTEST(lwm2m_registry, test_null_strings)
 {
 	int ret;
@@ -601,25 +601,30 @@ static void test_pingreq(void)
 	zassert_ok(ret, "MQTT client input processing failed (%d)", ret);
 }
 
-static void test_publish(enum mqtt_qos qos)
+static void publish_param_init(struct mqtt_publish_param *param, enum mqtt_qos qos)
 {
-	int ret;
-	struct mqtt_publish_param param;
-
 	test_ctx.payload_left = strlen(test_ctx.payload);
 	while (test_ctx.msg_id == 0) {
 		test_ctx.msg_id = sys_rand16_get();
 	}
 
-	param.message.topic.qos = qos;
-	param.message.topic.topic.utf8 = (uint8_t *)get_mqtt_topic();
-	param.message.topic.topic.size =
-			strlen(param.message.topic.topic.utf8);
-	param.message.payload.data = (uint8_t *)test_ctx.payload;
-	param.message.payload.len = test_ctx.payload_left;
-	param.message_id = test_ctx.msg_id;
-	param.dup_flag = 0U;
-	param.retain_flag = 0U;
+	param->message.topic.qos = qos;
+	param->message.topic.topic.utf8 = (uint8_t *)get_mqtt_topic();
+	param->message.topic.topic.size =
+			strlen(param->message.topic.topic.utf8);
+	param->message.payload.data = (uint8_t *)test_ctx.payload;
+	param->message.payload.len = test_ctx.payload_left;
+	param->message_id = test_ctx.msg_id;
+	param->dup_flag = 0U;
+	param->retain_flag = 0U;
+}
+
+static void test_publish(enum mqtt_qos qos)
+{
+	int ret;
+	struct mqtt_publish_param param;
+
+	publish_param_init(&param, qos);
 
 	ret = mqtt_publish(&client_ctx, &param);
 	zassert_ok(ret, "MQTT client failed to publish (%d)", ret);
@@ -768,6 +773,38 @@ ZTEST(mqtt_client, test_mqtt_publish_qos2)
 	test_disconnect();
 }
 
+ZTEST(mqtt_client, test_mqtt_publish_inflight_window)
+{
+	int ret;
+	struct mqtt_publish_param param;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_MQTT_INFLIGHT_WINDOW);
+
+	test_ctx.payload = payload_short;
+
+	test_connect();
+	publish_param_init(&param, MQTT_QOS_1_AT_LEAST_ONCE);
+
+	ret = mqtt_publish(&client_ctx, &param);
+	zassert_ok(ret, "MQTT client failed to publish (%d)", ret);
+
+	/* The window is full until the PUBACK is received. */
+	ret = mqtt_publish(&client_ctx, &param);
+	zassert_equal(ret, -EAGAIN, "Publish should be rejected (%d)", ret);
+
+	broker_process(MQTT_PKT_TYPE_PUBLISH);
+	client_wait(true);
+	ret = mqtt_input(&client_ctx);
+	zassert_ok(ret, "MQTT client input processing failed (%d)", ret);
+	zassert_true(test_ctx.puback_handled, "MQTT client should receive puback");
+
+	/* The acknowledged message released its slot. */
+	test_ctx.puback_handled = false;
+	test_publish(MQTT_QOS_1_AT_LEAST_ONCE);
+	zassert_true(test_ctx.puback_handled, "MQTT client should receive puback");
+	test_disconnect();
+}
+
 ZTEST(mqtt_client, test_mqtt_subscribe)
 {
 	test_connect();
@@ -0,0 +1,100 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <zephyr/net/prometheus/formatter.h>
+#include <zephyr/net/prometheus/kernel_stats.h>
+
+#define MAX_BUFFER_SIZE 1536
+#define TEST_SLAB_BLOCK_SIZE 64
+
+K_MEM_SLAB_DEFINE_STATIC(test_slab, TEST_SLAB_BLOCK_SIZE, 2, 4);
+
+static char formatted[MAX_BUFFER_SIZE];
+
+/* Return the value of the sample of metric name, or -1 if it is missing */
+static double sample_value(const char *name)
+{
+	char sample[64];
+	const char *line;
+
+	snprintf(sample, sizeof(sample), "\n%s{", name);
+	line = strstr(formatted, sample);
+	if (line == NULL) {
+		return -1;
+	}
+
+	line = strstr(line, "} ");
+	if (line == NULL) {
+		return -1;
+	}
+
+	return strtod(line + 2, NULL);
+}
+
+static void format_kernel_stats(void)
+{
+	int ret;
+
+	memset(formatted, 0, sizeof(formatted));
+	ret = prometheus_format_exposition(&kernel_stats_collector, formatted,
+					   sizeof(formatted));
+	zassert_ok(ret, "Error formatting exposition data (%d)", ret);
+}
+
+/**
+ * @brief Test kernel statistics exposition
+ * @details The test formats the kernel statistics collector and checks that
+ * every metric is exported with a value that follows the kernel state.
+ */
+ZTEST(test_kernel_stats, test_prometheus_kernel_stats)
+{
+	double allocated;
+	void *block;
+	void *mem;
+	int ret;
+
+	k_sleep(K_MSEC(10));
+	format_kernel_stats();
+	TC_PRINT("%s", formatted);
+
+	zassert_not_null(strstr(formatted, "# TYPE kernel_uptime_ms counter\n"),
+			 "Uptime metric missing");
+	zassert_true(sample_value("kernel_uptime_ms") >= 10, "Unexpected uptime");
+	zassert_true(sample_value("kernel_execution_cycles") > 0, "Unexpected CPU cycles");
+	zassert_true(sample_value("kernel_idle_cycles") >= 0, "Idle cycles missing");
+	zassert_true(sample_value("kernel_heap_free_bytes") > 0, "Unexpected heap free bytes");
+	zassert_true(sample_value("kernel_mem_slab_free_bytes") >= 2 * TEST_SLAB_BLOCK_SIZE,
+		     "Unexpected memory slab free bytes");
+
+	/* Allocations are visible on the next scrape */
+	allocated = sample_value("kernel_heap_allocated_bytes");
+	zassert_true(allocated >= 0, "Heap allocated bytes missing");
+	mem = k_malloc(128);
+	zassert_not_null(mem);
+
+	format_kernel_stats();
+	zassert_true(sample_value("kernel_heap_allocated_bytes") >= allocated + 128,
+		     "Heap allocation not reported");
+	k_free(mem);
+
+	allocated = sample_value("kernel_mem_slab_allocated_bytes");
+	zassert_true(allocated >= 0, "Memory slab allocated bytes missing");
+	ret = k_mem_slab_alloc(&test_slab, &block, K_NO_WAIT);
+	zassert_ok(ret);
+
+	format_kernel_stats();
+	zassert_true(sample_value("kernel_mem_slab_allocated_bytes") >=
+		     allocated + TEST_SLAB_BLOCK_SIZE, "Slab allocation not reported");
+	k_mem_slab_free(&test_slab, block);
+}
+
+ZTEST_SUITE(test_kernel_stats, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,183 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <fcntl.h>
+#include <zephyr/posix/aio.h>
+#include <zephyr/posix/unistd.h>
+#include "test_fs.h"
+
+#ifdef CONFIG_POSIX_AIO_FILE_SYSTEM
+
+#define AIO_FILE FATFS_MNTP"/aio.txt"
+
+static int aio_fd = -1;
+
+static void aio_before(void *unused)
+{
+	ARG_UNUSED(unused);
+
+	aio_fd = open(AIO_FILE, O_CREAT | O_RDWR, 0660);
+	zassert_true(aio_fd >= 0, "open failed, errno=%d", errno);
+}
+
+static void aio_after(void *unused)
+{
+	ARG_UNUSED(unused);
+
+	if (aio_fd >= 0) {
+		close(aio_fd);
+		aio_fd = -1;
+	}
+
+	unlink(AIO_FILE);
+}
+
+static ssize_t aio_wait_return(struct aiocb *cb)
+{
+	const struct aiocb *const list[] = {cb};
+
+	while (aio_error(cb) == EINPROGRESS) {
+		zassert_ok(aio_suspend(list, ARRAY_SIZE(list), NULL));
+	}
+
+	return aio_return(cb);
+}
+
+ZTEST_SUITE(posix_fs_aio_test, NULL, test_mount, aio_before, aio_after, test_unmount);
+
+/**
+ * @brief Test asynchronous write, fsync and read of a regular file
+ */
+ZTEST(posix_fs_aio_test, test_aio_write_read)
+{
+	char read_buff[sizeof(test_str)] = {0};
+	struct aiocb cb = {
+		.aio_fildes = aio_fd,
+		.aio_buf = (void *)test_str,
+		.aio_nbytes = strlen(test_str),
+		.aio_sigevent.sigev_notify = SIGEV_NONE,
+	};
+
+	zassert_ok(aio_write(&cb));
+	zassert_equal(aio_wait_return(&cb), strlen(test_str));
+
+	zassert_ok(aio_fsync(O_SYNC, &cb));
+	zassert_equal(aio_wait_return(&cb), 0);
+
+	/* Read back from a non-zero offset */
+	cb.aio_buf = read_buff;
+	cb.aio_offset = 2;
+	zassert_ok(aio_read(&cb));
+	zassert_equal(aio_wait_return(&cb), strlen(test_str) - 2);
+	zassert_str_equal(read_buff, test_str + 2);
+
+	/* The request has been reaped */
+	zassert_equal(aio_return(&cb), -1);
+	zassert_equal(errno, EINVAL);
+}
+
+/**
+ * @brief Test lio_listio() waiting for a list of requests
+ */
+ZTEST(posix_fs_aio_test, test_lio_listio)
+{
+	char read_buff[2][sizeof(test_str)] = {0};
+	struct aiocb wcb[2] = {
+		{
+			.aio_fildes = aio_fd,
+			.aio_buf = (void *)test_str,
+			.aio_nbytes = 5,
+			.aio_lio_opcode = LIO_WRITE,
+		},
+		{
+			.aio_fildes = aio_fd,
+			.aio_offset = 5,
+			.aio_buf = (void *)(test_str + 5),
+			.aio_nbytes = strlen(test_str) - 5,
+			.aio_lio_opcode = LIO_WRITE,
+		},
+	};
+	struct aiocb rcb[2] = {
+		{
+			.aio_fildes = aio_fd,
+			.aio_buf = read_buff[0],
+			.aio_nbytes = strlen(test_str),
+			.aio_lio_opcode = LIO_READ,
+		},
+		{
+			.aio_fildes = aio_fd,
+			.aio_offset = 6,
+			.aio_buf = read_buff[1],
+			.aio_nbytes = strlen(test_str) - 6,
+			.aio_lio_opcode = LIO_READ,
+		},
+	};
+	struct aiocb *wlist[] = {&wcb[0], NULL, &wcb[1]};
+	struct aiocb *rlist[] = {&rcb[0], &rcb[1]};
+
+	for (size_t i = 0; i < ARRAY_SIZE(wcb); i++) {
+		wcb[i].aio_sigevent.sigev_notify = SIGEV_NONE;
+		rcb[i].aio_sigevent.sigev_notify = SIGEV_NONE;
+	}
+
+	zassert_ok(lio_listio(LIO_WAIT, wlist, ARRAY_SIZE(wlist), NULL));
+	zassert_equal(aio_return(&wcb[0]), 5);
+	zassert_equal(aio_return(&wcb[1]), strlen(test_str) - 5);
+
+	zassert_ok(lio_listio(LIO_NOWAIT, rlist, ARRAY_SIZE(rlist), NULL));
+	zassert_equal(aio_wait_return(&rcb[0]), strlen(test_str));
+	zassert_equal(aio_wait_return(&rcb[1]), strlen(test_str) - 6);
+	zassert_str_equal(read_buff[0], test_str);
+	zassert_str_equal(read_buff[1], test_str + 6);
+}
+
+/**
+ * @brief Test argument checking of the asynchronous I/O functions
+ */
+ZTEST(posix_fs_aio_test, test_aio_invalid)
+{
+	char buf[4];
+	struct aiocb cb = {
+		.aio_fildes = aio_fd,
+		.aio_buf = buf,
+		.aio_nbytes = sizeof(buf),
+		.aio_sigevent.sigev_notify = SIGEV_NONE,
+	};
+	const struct aiocb *const list[] = {&cb};
+	struct timespec timeout = {0};
+
+	/* Unknown control blocks have no status */
+	zassert_equal(aio_error(&cb), -1);
+	zassert_equal(errno, EINVAL);
+
+	/* Requests that completed cannot be canceled */
+	zassert_equal(aio_cancel(aio_fd, NULL), AIO_ALLDONE);
+
+	/* Nothing was submitted, so the list counts as complete */
+	zassert_ok(aio_suspend(list, ARRAY_SIZE(list), &timeout));
+
+	cb.aio_offset = -1;
+	zassert_equal(aio_read(&cb), -1);
+	zassert_equal(errno, EINVAL);
+
+	cb.aio_offset = 0;
+	cb.aio_fildes = -1;
+	zassert_equal(aio_read(&cb), -1);
+	zassert_equal(errno, EBADF);
+
+	cb.aio_fildes = aio_fd;
+	cb.aio_sigevent.sigev_notify = SIGEV_SIGNAL;
+	zassert_equal(aio_read(&cb), -1);
+	zassert_equal(errno, EINVAL);
+
+	/* Only O_SYNC and O_DSYNC are valid synchronization requests */
+	cb.aio_sigevent.sigev_notify = SIGEV_NONE;
+	zassert_equal(aio_fsync(O_RDWR, &cb), -1);
+	zassert_equal(errno, EINVAL);
+}
+
+#endif /* CONFIG_POSIX_AIO_FILE_SYSTEM */
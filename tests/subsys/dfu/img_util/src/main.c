@@ -177,4 +177,56 @@ ZTEST(img_util, test_check_flash)
 	flash_area_close(ctx.flash_area);
 }
 
+#ifdef CONFIG_IMG_STREAM_HASH
+ZTEST(img_util, test_check_hash)
+{
+	/* sha256 of the 34 bytes 0x00, 0x01, ... 0x21 */
+	uint8_t tst_sha[] = { 0x14, 0xcd, 0xbf, 0x17, 0x14, 0x99, 0xf8, 0x6b,
+			      0xd1, 0x8b, 0x26, 0x22, 0x43, 0xd6, 0x69, 0x06,
+			      0x7e, 0xfb, 0xdb, 0xb5, 0x43, 0x1a, 0x48, 0x28,
+			      0x9c, 0xf0, 0x2f, 0x2b, 0x54, 0x48, 0xb3, 0xd4 };
+	struct flash_img_check fic = { tst_sha, 34 };
+	struct flash_img_context ctx;
+	uint8_t data[17];
+	int ret;
+
+	ret = flash_img_init_id(&ctx, UPLOAD_PARTITION_ID);
+	zassert_true(ret == 0, "Flash img init");
+	ret = flash_area_flatten(ctx.flash_area, 0, ctx.flash_area->fa_size);
+	zassert_true(ret == 0, "Flash erase failure (%d)", ret);
+
+	for (uint8_t i = 0; i < 2; i++) {
+		for (uint8_t j = 0; j < sizeof(data); j++) {
+			data[j] = i * sizeof(data) + j;
+		}
+
+		/* The hash is not available before the write has been flushed */
+		ret = flash_img_check_hash(&ctx, &fic);
+		zassert_equal(ret, -ENODATA, "Flash img check hash before flush: %d", ret);
+
+		ret = flash_img_buffered_write(&ctx, data, sizeof(data), i == 1);
+		zassert_true(ret == 0, "Flash img buffered write");
+	}
+
+	ret = flash_img_check_hash(&ctx, NULL);
+	zassert_equal(ret, -EINVAL, "Flash img check hash params");
+
+	ret = flash_img_check_hash(&ctx, &fic);
+	zassert_equal(ret, 0, "Flash img check hash: %d", ret);
+
+	/* The hash read back from flash is the same */
+	ret = flash_img_check(&ctx, &fic, UPLOAD_PARTITION_ID);
+	zassert_equal(ret, 0, "Flash img check: %d", ret);
+
+	fic.clen = 33;
+	ret = flash_img_check_hash(&ctx, &fic);
+	zassert_equal(ret, -ENODATA, "Flash img check hash length: %d", ret);
+
+	fic.clen = 34;
+	tst_sha[0] ^= 0xff;
+	ret = flash_img_check_hash(&ctx, &fic);
+	zassert_equal(ret, -EILSEQ, "Flash img check hash wrong sha: %d", ret);
+}
+#endif
+
 ZTEST_SUITE(img_util, NULL, NULL, NULL, NULL, NULL);
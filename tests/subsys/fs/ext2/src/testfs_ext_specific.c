@@ -4,10 +4,12 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <stdio.h>
 #include <zephyr/ztest.h>
 #include <zephyr/fs/fs.h>
 #include <zephyr/fs/ext2.h>
 #include "utils.h"
+#include "ext2_struct.h"
 #include "../../common/test_fs_util.h"
 
 uint32_t calculate_blocks(uint32_t freeb, uint32_t B)
@@ -190,6 +192,107 @@ ZTEST(ext2tests, test_indirect_block_removal)
 	zassert_equal(ret, 0, "Unmount failed (ret=%d)", ret);
 }
 
+#define INTERLEAVED_FILES 3
+#define INTERLEAVED_CHUNK 100
+#define INTERLEAVED_SIZE 6000
+
+#if CONFIG_EXT2_PREALLOC_BLOCKS > 0
+/* Blocks taken from one reserved run follow each other on the disk */
+static void check_contiguous(struct fs_file_t *file, uint32_t bsize)
+{
+	struct ext2_inode *inode = ((struct ext2_file *)file->filep)->f_inode;
+	uint32_t nblocks = DIV_ROUND_UP(INTERLEAVED_SIZE, bsize);
+
+	zassert_true(nblocks <= 12, "File does not fit in direct blocks");
+
+	for (uint32_t k = 1; k < nblocks; k++) {
+		if (k % CONFIG_EXT2_PREALLOC_BLOCKS == 0) {
+			continue;
+		}
+		zassert_equal(inode->i_block[k], inode->i_block[k - 1] + 1,
+			      "Block %u of inode %u at %u follows %u", k, inode->i_id,
+			      inode->i_block[k], inode->i_block[k - 1]);
+	}
+}
+#endif
+
+/* Grow several files in small alternating writes, then check them after a remount */
+ZTEST(ext2tests, test_interleaved_write)
+{
+	int ret = 0;
+	struct fs_mount_t *mp = &testfs_mnt;
+	struct fs_file_t files[INTERLEAVED_FILES];
+	char path[INTERLEAVED_FILES][16];
+	struct fs_statvfs sbuf;
+	uint32_t start;
+	uint32_t us;
+
+	ret = fs_mkfs(FS_EXT2, (uintptr_t)mp->storage_dev, NULL, 0);
+	zassert_equal(ret, 0, "Failed to mkfs");
+
+	mp->flags = FS_MOUNT_FLAG_NO_FORMAT;
+	ret = fs_mount(mp);
+	zassert_equal(ret, 0, "Mount failed (ret=%d)", ret);
+
+	ret = fs_statvfs(mp->mnt_point, &sbuf);
+	zassert_equal(ret, 0, "Expected success (ret=%d)", ret);
+
+	for (int i = 0; i < INTERLEAVED_FILES; i++) {
+		snprintf(path[i], sizeof(path[i]), "/sml/file%d", i);
+		fs_file_t_init(&files[i]);
+		ret = fs_open(&files[i], path[i], FS_O_RDWR | FS_O_CREATE);
+		zassert_equal(ret, 0, "File open failed (ret=%d)", ret);
+	}
+
+	start = k_cycle_get_32();
+	for (uint32_t off = 0; off < INTERLEAVED_SIZE; off += INTERLEAVED_CHUNK) {
+		for (int i = 0; i < INTERLEAVED_FILES; i++) {
+			ret = testfs_write_incrementing(&files[i], off + i, INTERLEAVED_CHUNK);
+			zassert_equal(ret, INTERLEAVED_CHUNK, "Write failed (ret=%d)", ret);
+		}
+	}
+
+	for (int i = 0; i < INTERLEAVED_FILES; i++) {
+#if CONFIG_EXT2_PREALLOC_BLOCKS > 0
+		check_contiguous(&files[i], sbuf.f_bsize);
+#endif
+		ret = fs_close(&files[i]);
+		zassert_equal(ret, 0, "File close failed (ret=%d)", ret);
+	}
+	us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+
+	/* Compare against the prealloc and writeback variants of this test */
+	TC_PRINT("Wrote %d files of %d bytes in %d byte chunks in %u us "
+			"(prealloc %d blocks, writeback %s)\n",
+			INTERLEAVED_FILES, INTERLEAVED_SIZE, INTERLEAVED_CHUNK, us,
+			CONFIG_EXT2_PREALLOC_BLOCKS,
+			IS_ENABLED(CONFIG_EXT2_WRITEBACK_CACHE) ? "on" : "off");
+
+	/* Remounting verifies the bitmaps against the superblock counters */
+	ret = fs_unmount(mp);
+	zassert_equal(ret, 0, "Unmount failed (ret=%d)", ret);
+	ret = fs_mount(mp);
+	zassert_equal(ret, 0, "Mount failed (ret=%d)", ret);
+
+	for (int i = 0; i < INTERLEAVED_FILES; i++) {
+		fs_file_t_init(&files[i]);
+		ret = fs_open(&files[i], path[i], FS_O_READ);
+		zassert_equal(ret, 0, "File open failed (ret=%d)", ret);
+
+		ret = testfs_verify_incrementing(&files[i], i, INTERLEAVED_SIZE);
+		zassert_equal(ret, INTERLEAVED_SIZE, "Different number of bytes read %d (expected %d)",
+				ret, INTERLEAVED_SIZE);
+
+		ret = fs_close(&files[i]);
+		zassert_equal(ret, 0, "File close failed (ret=%d)", ret);
+		ret = fs_unlink(path[i]);
+		zassert_equal(ret, 0, "Unlink failed (ret=%d)", ret);
+	}
+
+	ret = fs_unmount(mp);
+	zassert_equal(ret, 0, "Unmount failed (ret=%d)", ret);
+}
+
 ZTEST(ext2tests, test_write_big_file)
 {
 	writing_test(NULL);
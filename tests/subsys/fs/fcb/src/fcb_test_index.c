@@ -0,0 +1,106 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "fcb_test.h"
+
+#ifdef CONFIG_FCB_INDEX
+
+#define TEST_INDEX_MAX_ENTRIES 2048
+
+static struct fcb_entry index_entries[TEST_INDEX_MAX_ENTRIES];
+
+static bool fcb_test_entry_equal(const struct fcb_entry *a, const struct fcb_entry *b)
+{
+	return a->fe_sector == b->fe_sector && a->fe_elem_off == b->fe_elem_off &&
+	       a->fe_data_off == b->fe_data_off && a->fe_data_len == b->fe_data_len;
+}
+
+static int fcb_test_collect(struct fcb *fcb)
+{
+	struct fcb_entry loc = {0};
+	int cnt = 0;
+
+	while (fcb_getnext(fcb, &loc) == 0) {
+		zassert_true(cnt < TEST_INDEX_MAX_ENTRIES, "too many entries");
+		index_entries[cnt++] = loc;
+	}
+
+	return cnt;
+}
+
+ZTEST(fcb_test_with_4sectors_set, test_fcb_index)
+{
+	struct fcb *fcb = &test_fcb;
+	struct fcb_entry loc;
+	uint8_t test_data[128];
+	uint32_t seq[2];
+	uint32_t first_seq;
+	int rotations = 0;
+	int cnt;
+	int rc;
+
+	/* Fill the buffer with entries of varying length, rotating twice */
+	for (int i = 0; rotations < 2; i++) {
+		uint16_t len = 16 + i % 100;
+
+		rc = fcb_append(fcb, len, &loc);
+		if (rc == -ENOSPC) {
+			zassert_ok(fcb_rotate(fcb), "fcb_rotate call failure");
+			rotations++;
+			continue;
+		}
+		zassert_ok(rc, "fcb_append call failure");
+
+		memset(test_data, i, sizeof(test_data));
+		rc = flash_area_write(fcb->fap, FCB_ENTRY_FA_DATA_OFF(loc), test_data, len);
+		zassert_ok(rc, "flash_area_write call failure");
+		zassert_ok(fcb_append_finish(fcb, &loc), "fcb_append_finish call failure");
+	}
+
+	cnt = fcb_test_collect(fcb);
+	zassert_true(cnt > CONFIG_FCB_INDEX_SECTOR_ENTRIES * 4, "not enough entries: %d", cnt);
+
+	/* The indexed lookup gives the same entries as a walk */
+	for (int n = 1; n <= 255; n++) {
+		rc = fcb_offset_last_n(fcb, n, &loc);
+		zassert_ok(rc, "fcb_offset_last_n call failure");
+		zassert_true(fcb_test_entry_equal(&loc, &index_entries[MAX(cnt - n, 0)]),
+			     "fcb_offset_last_n: fetched wrong %d-th location", n);
+	}
+
+	/* Sequence numbers increase and lead back to their entry */
+	for (int i = 0; i < cnt; i++) {
+		rc = fcb_entry_seq(fcb, &index_entries[i], &seq[i % 2]);
+		zassert_ok(rc, "fcb_entry_seq call failure");
+		if (i > 0) {
+			zassert_true(seq[i % 2] > seq[(i + 1) % 2], "sequence number not increasing");
+		}
+
+		rc = fcb_seek(fcb, seq[i % 2], &loc);
+		zassert_ok(rc, "fcb_seek call failure");
+		zassert_true(fcb_test_entry_equal(&loc, &index_entries[i]),
+			     "fcb_seek: fetched wrong location for entry %d", i);
+	}
+
+	/* Entries of a rotated out sector can not be found anymore */
+	zassert_ok(fcb_entry_seq(fcb, &index_entries[0], &first_seq));
+	zassert_ok(fcb_rotate(fcb), "fcb_rotate call failure");
+	rc = fcb_seek(fcb, first_seq, &loc);
+	zassert_equal(rc, -ENOENT, "fcb_seek of rotated entry returned %d", rc);
+
+	/* The index rebuilt at init gives the same sequence numbers */
+	cnt = fcb_test_collect(fcb);
+	zassert_ok(fcb_entry_seq(fcb, &index_entries[cnt - 1], &seq[0]));
+	zassert_ok(fcb_init(TEST_FCB_FLASH_AREA_ID, fcb), "fcb_init call failure");
+	zassert_ok(fcb_seek(fcb, seq[0], &loc), "fcb_seek call failure");
+	zassert_true(fcb_test_entry_equal(&loc, &index_entries[cnt - 1]),
+		     "fcb_seek: fetched wrong location after init");
+	zassert_ok(fcb_offset_last_n(fcb, 1, &loc), "fcb_offset_last_n call failure");
+	zassert_true(fcb_test_entry_equal(&loc, &index_entries[cnt - 1]),
+		     "fcb_offset_last_n: fetched wrong location after init");
+}
+
+#endif /* CONFIG_FCB_INDEX */
@@ -49,6 +49,9 @@ struct flash_sector test_fcb_sector[] = {
 	}
 };
 
+#ifdef CONFIG_FCB_INDEX
+static struct fcb_sector_index test_fcb_index[ARRAY_SIZE(test_fcb_sector)];
+#endif
 
 void test_fcb_wipe(void)
 {
@@ -120,6 +123,9 @@ void fcb_tc_pretest(int sectors, struct fcb *_fcb)
 	_fcb->f_erase_value = fcb_test_erase_value;
 	_fcb->f_sector_cnt = sectors;
 	_fcb->f_sectors = test_fcb_sector; /* XXX */
+#ifdef CONFIG_FCB_INDEX
+	_fcb->f_index = test_fcb_index;
+#endif
 
 	rc = 0;
 	rc = fcb_init(TEST_FCB_FLASH_AREA_ID, _fcb);
@@ -0,0 +1,141 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* littlefs small-file churn and per-mount file caches */
+
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/fs/littlefs.h>
+#include "testfs_tests.h"
+#include "testfs_lfs.h"
+
+#define CHURN_FILES 8
+#define CHURN_ROUNDS 16
+#define CHURN_WRITES 8
+#define CHURN_WRITE_SIZE 24
+
+static uint8_t churn_buf[CHURN_WRITE_SIZE];
+
+static void churn_path(struct testfs_path *path, struct fs_mount_t *mp, size_t idx)
+{
+	char name[12];
+
+	snprintf(name, sizeof(name), "f%zu", idx);
+	testfs_path_init(path, mp, name, TESTFS_PATH_END);
+}
+
+/* Repeatedly create, fill with small writes, check and remove a set of files */
+static void churn(const char *tag, struct fs_mount_t *mp)
+{
+	const struct lfs_config *lcp = &((const struct fs_littlefs *)mp->fs_data)->cfg;
+	struct testfs_path path;
+	struct fs_dirent stat;
+	struct fs_file_t file;
+	uint32_t t0;
+	uint32_t ms;
+	uint32_t ops = 0;
+	int rc;
+
+	zassert_equal(testfs_lfs_wipe_partition(mp), TC_PASS);
+	zassert_equal(fs_mount(mp), 0, "mount failed");
+
+	for (size_t i = 0; i < sizeof(churn_buf); i++) {
+		churn_buf[i] = i;
+	}
+
+	fs_file_t_init(&file);
+	t0 = k_uptime_get_32();
+	for (size_t round = 0; round < CHURN_ROUNDS; round++) {
+		for (size_t f = 0; f < CHURN_FILES; f++) {
+			churn_path(&path, mp, f);
+			rc = fs_open(&file, path.path, FS_O_CREATE | FS_O_WRITE);
+			zassert_equal(rc, 0, "open %s failed: %d", path.path, rc);
+
+			for (size_t w = 0; w < CHURN_WRITES; w++) {
+				rc = fs_write(&file, churn_buf, sizeof(churn_buf));
+				zassert_equal(rc, sizeof(churn_buf), "write failed: %d", rc);
+			}
+
+			zassert_equal(fs_close(&file), 0, "close failed");
+			ops++;
+		}
+
+		for (size_t f = 0; f < CHURN_FILES; f++) {
+			churn_path(&path, mp, f);
+			zassert_equal(fs_stat(path.path, &stat), 0, "stat failed");
+			zassert_equal(stat.size, CHURN_WRITES * CHURN_WRITE_SIZE,
+				      "unexpected size %zu", stat.size);
+			zassert_equal(fs_unlink(path.path), 0, "unlink failed");
+			ops++;
+		}
+	}
+	ms = MAX(k_uptime_get_32() - t0, 1U);
+
+	TC_PRINT("%s churn: cache_size %u ; %u files * %u rounds of %u * %u bytes: "
+		 "%u ops in %u ms, %u ops/s\n",
+		 tag, lcp->cache_size, CHURN_FILES, CHURN_ROUNDS, CHURN_WRITES,
+		 CHURN_WRITE_SIZE, ops, ms, ops * 1000U / ms);
+
+	zassert_equal(fs_unmount(mp), 0);
+}
+
+ZTEST(littlefs, test_lfs_churn)
+{
+	k_sleep(K_MSEC(100));   /* flush log messages */
+	churn("small dflt", &testfs_small_mnt);
+
+	if (IS_ENABLED(CONFIG_APP_TEST_CUSTOM)) {
+		k_sleep(K_MSEC(100));   /* flush log messages */
+		churn("medium file cache", &testfs_medium_mnt);
+	}
+}
+
+ZTEST(littlefs, test_lfs_file_cache)
+{
+	struct fs_mount_t *mp = &testfs_medium_mnt;
+	struct fs_file_t files[MEDIUM_NUM_FILES + 1];
+	struct testfs_path path;
+	int rc;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_APP_TEST_CUSTOM);
+
+	zassert_equal(testfs_lfs_wipe_partition(mp), TC_PASS);
+	zassert_equal(fs_mount(mp), 0, "mount failed");
+
+	/* Files on the mount share its pool, not the global heap */
+	for (size_t i = 0; i < ARRAY_SIZE(files); i++) {
+		fs_file_t_init(&files[i]);
+		churn_path(&path, mp, i);
+		rc = fs_open(&files[i], path.path, FS_O_CREATE | FS_O_RDWR);
+		if (i < MEDIUM_NUM_FILES) {
+			zassert_equal(rc, 0, "open %zu failed: %d", i, rc);
+		} else {
+			zassert_equal(rc, -ENOMEM, "open past pool returned %d", rc);
+		}
+	}
+
+	/* Other mounts are unaffected */
+	zassert_equal(fs_mount(&testfs_small_mnt), 0, "small mount failed");
+	churn_path(&path, &testfs_small_mnt, 0);
+	rc = fs_open(&files[MEDIUM_NUM_FILES], path.path, FS_O_CREATE | FS_O_RDWR);
+	zassert_equal(rc, 0, "open on small failed: %d", rc);
+	zassert_equal(fs_close(&files[MEDIUM_NUM_FILES]), 0);
+	zassert_equal(fs_unmount(&testfs_small_mnt), 0);
+
+	/* A released cache can be reused */
+	zassert_equal(fs_close(&files[0]), 0);
+	churn_path(&path, mp, MEDIUM_NUM_FILES);
+	rc = fs_open(&files[0], path.path, FS_O_CREATE | FS_O_RDWR);
+	zassert_equal(rc, 0, "reopen failed: %d", rc);
+
+	for (size_t i = 0; i < MEDIUM_NUM_FILES; i++) {
+		zassert_equal(fs_close(&files[i]), 0);
+	}
+
+	zassert_equal(fs_unmount(mp), 0);
+}
@@ -0,0 +1,184 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* littlefs asynchronous I/O through the file system RTIO device */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/fs/fs_rtio.h>
+#include <zephyr/rtio/rtio.h>
+#include "testfs_tests.h"
+#include "testfs_lfs.h"
+
+#ifdef CONFIG_FILE_SYSTEM_RTIO
+
+#define RTIO_BUF_SIZE 1024
+#define RTIO_NBUF 16
+#define RTIO_QUEUE_DEPTH 4
+
+RTIO_DEFINE(lfs_rtio, RTIO_QUEUE_DEPTH, RTIO_QUEUE_DEPTH);
+#ifdef CONFIG_RTIO_SYS_MEM_BLOCKS
+RTIO_DEFINE_WITH_MEMPOOL(lfs_pool_rtio, 1, 1, 2, RTIO_BUF_SIZE, 4);
+#endif
+
+static uint8_t wbuf[RTIO_QUEUE_DEPTH][RTIO_BUF_SIZE];
+static uint8_t rbuf[RTIO_BUF_SIZE];
+
+static void fill_buf(uint8_t *buf, size_t idx)
+{
+	for (size_t i = 0; i < RTIO_BUF_SIZE; i++) {
+		buf[i] = (uint8_t)(idx + i);
+	}
+}
+
+static int consume_result(void)
+{
+	struct rtio_cqe *cqe = rtio_cqe_consume_block(&lfs_rtio);
+	int result = cqe->result;
+
+	rtio_cqe_release(&lfs_rtio, cqe);
+
+	return result;
+}
+
+static void print_rate(const char *tag, uint32_t ms, uint32_t busy_ms)
+{
+	size_t total = RTIO_NBUF * RTIO_BUF_SIZE;
+
+	ms = MAX(ms, 1U);
+	TC_PRINT("rtio %s %u * %u = %zu bytes in %u ms (submitter busy %u ms): "
+		 "%u By/s, %u KiBy/s\n",
+		 tag, RTIO_NBUF, RTIO_BUF_SIZE, total, ms, busy_ms,
+		 (uint32_t)(total * 1000U / ms),
+		 (uint32_t)(total * 1000U / ms / 1024U));
+}
+
+ZTEST(littlefs, test_lfs_rtio)
+{
+	struct fs_mount_t *mp = &testfs_small_mnt;
+	struct testfs_path path;
+	struct fs_dirent stat;
+	struct fs_rtio_file data;
+	struct rtio_iodev iodev;
+	struct fs_file_t file;
+	struct rtio_sqe *sqe;
+	uint32_t busy;
+	uint32_t t0;
+	uint32_t t1;
+	size_t inflight = 0;
+	int rc;
+
+	k_sleep(K_MSEC(100));   /* flush log messages */
+
+	zassert_equal(testfs_lfs_wipe_partition(mp), TC_PASS);
+	zassert_equal(fs_mount(mp), 0, "mount failed");
+
+	testfs_path_init(&path, mp, "rtio", TESTFS_PATH_END);
+	fs_file_t_init(&file);
+	zassert_equal(fs_open(&file, path.path, FS_O_CREATE | FS_O_RDWR), 0, "open failed");
+
+	/* Keep the queue full, appending at the current position */
+	fs_rtio_iodev_init(&iodev, &data, &file, FS_RTIO_OFFSET_CURRENT);
+
+	busy = 0;
+	t0 = k_uptime_get_32();
+	for (size_t i = 0; i < RTIO_NBUF; i++) {
+		if (inflight == RTIO_QUEUE_DEPTH) {
+			zassert_equal(consume_result(), RTIO_BUF_SIZE, "write failed");
+			inflight--;
+		}
+
+		fill_buf(wbuf[i % RTIO_QUEUE_DEPTH], i);
+
+		t1 = k_uptime_get_32();
+		sqe = rtio_sqe_acquire(&lfs_rtio);
+		zassert_not_null(sqe);
+		rtio_sqe_prep_write(sqe, &iodev, RTIO_PRIO_NORM, wbuf[i % RTIO_QUEUE_DEPTH],
+				    RTIO_BUF_SIZE, NULL);
+		zassert_equal(rtio_submit(&lfs_rtio, 0), 0);
+		busy += k_uptime_get_32() - t1;
+		inflight++;
+	}
+
+	while (inflight > 0) {
+		zassert_equal(consume_result(), RTIO_BUF_SIZE, "write failed");
+		inflight--;
+	}
+
+	sqe = rtio_sqe_acquire(&lfs_rtio);
+	zassert_not_null(sqe);
+	fs_rtio_sqe_prep_sync(sqe, &iodev, NULL);
+	zassert_equal(rtio_submit(&lfs_rtio, 1), 0);
+	zassert_equal(consume_result(), 0, "sync failed");
+	print_rate("write", k_uptime_get_32() - t0, busy);
+
+	zassert_equal(fs_stat(path.path, &stat), 0);
+	zassert_equal(stat.size, RTIO_NBUF * RTIO_BUF_SIZE, "unexpected file size %zu",
+		      stat.size);
+
+	/* Read back in reverse order, each request at an explicit offset */
+	t0 = k_uptime_get_32();
+	for (size_t i = RTIO_NBUF; i-- > 0;) {
+		data.offset = i * RTIO_BUF_SIZE;
+
+		sqe = rtio_sqe_acquire(&lfs_rtio);
+		zassert_not_null(sqe);
+		rtio_sqe_prep_read(sqe, &iodev, RTIO_PRIO_NORM, rbuf, sizeof(rbuf), NULL);
+		zassert_equal(rtio_submit(&lfs_rtio, 1), 0);
+		zassert_equal(consume_result(), RTIO_BUF_SIZE, "read failed");
+		zassert_equal(data.offset, (i + 1) * RTIO_BUF_SIZE, "offset not advanced");
+
+		fill_buf(wbuf[0], i);
+		zassert_mem_equal(rbuf, wbuf[0], RTIO_BUF_SIZE, "block %zu mismatch", i);
+	}
+	print_rate("read", k_uptime_get_32() - t0, 0);
+
+	/* Reading past the end of the file transfers nothing */
+	data.offset = RTIO_NBUF * RTIO_BUF_SIZE;
+	sqe = rtio_sqe_acquire(&lfs_rtio);
+	zassert_not_null(sqe);
+	rtio_sqe_prep_read(sqe, &iodev, RTIO_PRIO_NORM, rbuf, sizeof(rbuf), NULL);
+	zassert_equal(rtio_submit(&lfs_rtio, 1), 0);
+	zassert_equal(consume_result(), 0, "read at end of file");
+
+#ifdef CONFIG_RTIO_SYS_MEM_BLOCKS
+	/* Reads into the memory pool fill one block */
+	struct rtio_cqe *cqe;
+	uint32_t pool_buf_len;
+	uint8_t *pool_buf;
+
+	data.offset = RTIO_BUF_SIZE;
+	sqe = rtio_sqe_acquire(&lfs_pool_rtio);
+	zassert_not_null(sqe);
+	rtio_sqe_prep_read_with_pool(sqe, &iodev, RTIO_PRIO_NORM, NULL);
+	zassert_equal(rtio_submit(&lfs_pool_rtio, 1), 0);
+
+	cqe = rtio_cqe_consume_block(&lfs_pool_rtio);
+	zassert_equal(cqe->result, RTIO_BUF_SIZE, "pool read returned %d", cqe->result);
+	zassert_equal(rtio_cqe_get_mempool_buffer(&lfs_pool_rtio, cqe, &pool_buf,
+						  &pool_buf_len), 0);
+	zassert_equal(pool_buf_len, RTIO_BUF_SIZE);
+	fill_buf(wbuf[0], 1);
+	zassert_mem_equal(pool_buf, wbuf[0], RTIO_BUF_SIZE, "pool read mismatch");
+	rtio_release_buffer(&lfs_pool_rtio, pool_buf, pool_buf_len);
+	rtio_cqe_release(&lfs_pool_rtio, cqe);
+#endif
+
+	zassert_equal(fs_close(&file), 0);
+
+	/* Requests on a closed file fail */
+	sqe = rtio_sqe_acquire(&lfs_rtio);
+	zassert_not_null(sqe);
+	rtio_sqe_prep_read(sqe, &iodev, RTIO_PRIO_NORM, rbuf, sizeof(rbuf), NULL);
+	zassert_equal(rtio_submit(&lfs_rtio, 1), 0);
+	rc = consume_result();
+	zassert_equal(rc, -EBADF, "read of closed file returned %d", rc);
+
+	zassert_equal(fs_unmount(mp), 0);
+}
+
+#endif /* CONFIG_FILE_SYSTEM_RTIO */
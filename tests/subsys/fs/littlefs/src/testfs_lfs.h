@@ -21,6 +21,7 @@ extern struct fs_mount_t testfs_large_mnt;
 #define MEDIUM_IO_SIZE 64
 #define MEDIUM_CACHE_SIZE 256
 #define MEDIUM_LOOKAHEAD_SIZE 64
+#define MEDIUM_NUM_FILES 2
 
 #define LARGE_IO_SIZE 256
 #define LARGE_CACHE_SIZE 1024
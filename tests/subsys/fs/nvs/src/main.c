@@ -89,6 +89,9 @@ static void after(void *data)
 	}
 
 	fixture->fs.sector_count = TEST_SECTOR_COUNT;
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	fixture->fs.gc_threshold = 0;
+#endif
 }
 
 ZTEST_SUITE(nvs, NULL, setup, before, after, NULL);
@@ -654,6 +657,91 @@ ZTEST_F(nvs, test_delete)
 		     " any footprint in the storage");
 }
 
+#define TEST_WALK_IDS 10
+
+struct walk_result {
+	struct nvs_walk_entry newest[TEST_WALK_IDS];
+	size_t count;
+};
+
+static int walk_cb(const struct nvs_walk_entry *entry, void *arg)
+{
+	struct walk_result *result = arg;
+
+	zassert_true(entry->id < TEST_WALK_IDS, "unexpected id %u", entry->id);
+
+	if (result->newest[entry->id].ate_addr == 0U) {
+		result->newest[entry->id] = *entry;
+	}
+	result->count++;
+
+	return 0;
+}
+
+static int walk_stop_cb(const struct nvs_walk_entry *entry, void *arg)
+{
+	return 1;
+}
+
+/**
+ * nvs_walk() reports every entry, the newest one of each id first.
+ */
+ZTEST_F(nvs, test_nvs_walk)
+{
+	int err;
+	ssize_t len;
+	uint16_t id, value, data_read;
+	struct walk_result result = {0};
+	uint32_t gc_count;
+
+	fixture->fs.sector_count = 3;
+
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0,  "nvs_mount call failure: %d", err);
+
+	for (id = 0; id < TEST_WALK_IDS; id++) {
+		len = nvs_write(&fixture->fs, id, &id, sizeof(id));
+		zassert_true(len == sizeof(id), "nvs_write failed: %d", len);
+	}
+
+	/* write the second versions to the next sector */
+	gc_count = nvs_gc_count_get(&fixture->fs);
+	err = nvs_sector_use_next(&fixture->fs);
+	zassert_true(err == 0,  "nvs_sector_use_next call failure: %d", err);
+	zassert_equal(nvs_gc_count_get(&fixture->fs), gc_count + 1,
+		      "garbage collection not counted");
+
+	for (id = 0; id < TEST_WALK_IDS; id++) {
+		value = id + 100;
+		len = nvs_write(&fixture->fs, id, &value, sizeof(value));
+		zassert_true(len == sizeof(value), "nvs_write failed: %d", len);
+	}
+
+	err = nvs_delete(&fixture->fs, 1);
+	zassert_true(err == 0,  "nvs_delete call failure: %d", err);
+
+	err = nvs_walk(&fixture->fs, walk_cb, &result);
+	zassert_true(err == 0,  "nvs_walk call failure: %d", err);
+	zassert_equal(result.count, 2 * TEST_WALK_IDS + 1, "walked %zu entries", result.count);
+
+	for (id = 0; id < TEST_WALK_IDS; id++) {
+		len = nvs_walk_read(&fixture->fs, &result.newest[id], &data_read,
+				    sizeof(data_read));
+		if (id == 1) {
+			zassert_equal(result.newest[id].len, 0, "deleted entry has data");
+			zassert_equal(len, -ENOENT, "deleted entry read: %d", len);
+			continue;
+		}
+
+		zassert_equal(result.newest[id].len, sizeof(data_read));
+		zassert_equal(len, sizeof(data_read), "nvs_walk_read failed: %d", len);
+		zassert_equal(data_read, id + 100, "read old data %u for id %u", data_read, id);
+	}
+
+	err = nvs_walk(&fixture->fs, walk_stop_cb, NULL);
+	zassert_equal(err, 1, "nvs_walk did not stop: %d", err);
+}
+
 #ifdef CONFIG_TEST_NVS_SIMULATOR
 /*
  * Test that garbage-collection can recover all ate's even when the last ate,
@@ -1019,3 +1107,80 @@ ZTEST_F(nvs, test_nvs_init_bad_memory_region)
 #endif
 }
 #endif /* CONFIG_TEST_NVS_SIMULATOR */
+
+#if defined(CONFIG_NVS_BACKGROUND_GC) && defined(CONFIG_TEST_NVS_SIMULATOR)
+/**
+ * Garbage collection runs on the system work queue, foreground writes never
+ * erase flash.
+ */
+ZTEST_F(nvs, test_nvs_background_gc)
+{
+	int err;
+	ssize_t len;
+	uint8_t buf[32];
+	uint32_t *flash_erase_stat;
+	uint32_t erase_calls;
+	uint32_t cycles;
+	uint32_t max_cycles = 0;
+	const uint16_t max_id = 10;
+	/* Go around all sectors twice */
+	const uint16_t max_writes = 2 * TEST_SECTOR_COUNT * fixture->fs.sector_size /
+				    (sizeof(buf) + sizeof(struct nvs_ate));
+
+	stats_walk(fixture->sim_stats, flash_sim_erase_calls_find, &flash_erase_stat);
+
+	/* Keep the work queue from preempting the writes, so that erases done
+	 * by the work item are not accounted to them.
+	 */
+	k_thread_priority_set(k_current_get(), K_PRIO_COOP(0));
+
+	fixture->fs.gc_threshold = fixture->fs.sector_size / 4;
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	for (uint16_t i = 0; i < max_writes; i++) {
+		uint8_t id = (i % max_id);
+		uint8_t id_data = id + max_id * (i / max_id);
+
+		memset(buf, id_data, sizeof(buf));
+
+		erase_calls = *flash_erase_stat;
+		cycles = k_cycle_get_32();
+		len = nvs_write(&fixture->fs, id, buf, sizeof(buf));
+		cycles = k_cycle_get_32() - cycles;
+		zassert_true(len == sizeof(buf), "nvs_write failed: %d", len);
+		zassert_equal(*flash_erase_stat, erase_calls, "write %u erased flash", i);
+		max_cycles = MAX(max_cycles, cycles);
+
+		/* Idle time for the work queue */
+		k_sleep(K_MSEC(1));
+	}
+
+	zassert_true(*flash_erase_stat > 0, "no background gc happened");
+	TC_PRINT("%u writes, %u erases, max write time %u us\n", max_writes,
+		 *flash_erase_stat, k_cyc_to_us_ceil32(max_cycles));
+	check_content(max_id, &fixture->fs);
+
+	/* Without a threshold gc only runs when nvs_write_nowait() asks for it */
+	fixture->fs.gc_threshold = 0;
+	memset(buf, 0, sizeof(buf));
+
+	while (true) {
+		buf[0]++;
+		erase_calls = *flash_erase_stat;
+		len = nvs_write_nowait(&fixture->fs, max_id, buf, sizeof(buf));
+		zassert_equal(*flash_erase_stat, erase_calls, "nowait write erased flash");
+		if (len == -EAGAIN) {
+			break;
+		}
+		zassert_true(len == sizeof(buf), "nvs_write_nowait failed: %d", len);
+	}
+
+	k_sleep(K_MSEC(1));
+	zassert_true(*flash_erase_stat > erase_calls, "gc did not run");
+
+	len = nvs_write_nowait(&fixture->fs, max_id, buf, sizeof(buf));
+	zassert_true(len == sizeof(buf), "nvs_write_nowait failed: %d", len);
+	check_content(max_id, &fixture->fs);
+}
+#endif
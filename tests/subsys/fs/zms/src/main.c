@@ -1318,3 +1318,142 @@ ZTEST_F(zms, test_zms_free_space_5sectors)
 	zassert_equal(free_space_total, zms_calc_free_space(&fixture->fs),
 		      "total free space did not match sum of gc'd sectors");
 }
+
+static void fill_batch(struct zms_batch_entry *batch, size_t count, uint8_t *buf, size_t len)
+{
+	for (size_t i = 0; i < count; i++) {
+		batch[i].id = i;
+		batch[i].data = buf;
+		batch[i].len = len;
+	}
+}
+
+static void check_batch_content(struct zms_fs *fs, size_t count, uint8_t value)
+{
+	uint8_t rd_buf[32];
+	uint8_t buf[32];
+	ssize_t len;
+
+	memset(buf, value, sizeof(buf));
+
+	for (zms_id_t id = 0; id < count; id++) {
+		len = zms_read(fs, id, rd_buf, sizeof(rd_buf));
+		zassert_equal(len, sizeof(rd_buf), "zms_read unexpected failure: %d", len);
+		zassert_mem_equal(buf, rd_buf, sizeof(rd_buf), "unexpected content of id %u",
+				  (uint32_t)id);
+	}
+}
+
+/**
+ * Write several entries with one batch
+ */
+ZTEST_F(zms, test_zms_write_batch)
+{
+	int err;
+	ssize_t len;
+	uint8_t buf[32];
+	uint32_t small = 0xdeadbeef;
+	uint32_t rd_small;
+	struct zms_batch_entry batch[4];
+
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	memset(buf, 0xa5, sizeof(buf));
+	fill_batch(batch, ARRAY_SIZE(batch), buf, sizeof(buf));
+	zassert_true(zms_batch_fits(&fixture->fs, batch, ARRAY_SIZE(batch)));
+	len = zms_write_batch(&fixture->fs, batch, ARRAY_SIZE(batch));
+	zassert_equal(len, ARRAY_SIZE(batch) * sizeof(buf), "zms_write_batch failed: %d", len);
+	check_batch_content(&fixture->fs, ARRAY_SIZE(batch), 0xa5);
+
+	/* Data stored in the ATE and deletes are part of a batch as well */
+	batch[2].data = &small;
+	batch[2].len = sizeof(small);
+	batch[3].data = NULL;
+	batch[3].len = 0;
+	len = zms_write_batch(&fixture->fs, &batch[2], 2);
+	zassert_equal(len, sizeof(small), "zms_write_batch failed: %d", len);
+
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	check_batch_content(&fixture->fs, 2, 0xa5);
+	len = zms_read(&fixture->fs, 2, &rd_small, sizeof(rd_small));
+	zassert_equal(len, sizeof(rd_small), "zms_read unexpected failure: %d", len);
+	zassert_equal(rd_small, small, "unexpected content");
+	len = zms_read(&fixture->fs, 3, buf, sizeof(buf));
+	zassert_equal(len, -ENOENT, "deleted entry found: %d", len);
+
+	/* The entries are kept by garbage collection */
+	for (int i = 0; i < fixture->fs.sector_count; i++) {
+		err = zms_sector_use_next(&fixture->fs);
+		zassert_true(err == 0, "zms_sector_use_next call failure: %d", err);
+	}
+	check_batch_content(&fixture->fs, 2, 0xa5);
+
+	/* Invalid batches */
+	len = zms_write_batch(&fixture->fs, batch, 0);
+	zassert_equal(len, -EINVAL, "empty batch accepted: %d", len);
+	batch[0].data = NULL;
+	len = zms_write_batch(&fixture->fs, batch, 1);
+	zassert_equal(len, -EINVAL, "batch without data accepted: %d", len);
+	fill_batch(batch, ARRAY_SIZE(batch), buf, UINT16_MAX);
+	zassert_false(zms_batch_fits(&fixture->fs, batch, ARRAY_SIZE(batch)));
+	len = zms_write_batch(&fixture->fs, batch, ARRAY_SIZE(batch));
+	zassert_equal(len, -EINVAL, "batch larger than a sector accepted: %d", len);
+}
+
+#ifdef CONFIG_TEST_ZMS_SIMULATOR
+/**
+ * A batch interrupted by a power loss is dropped as a whole
+ */
+ZTEST_F(zms, test_zms_write_batch_power_loss)
+{
+	int err;
+	ssize_t len;
+	uint8_t buf[32];
+	uint32_t *flash_write_stat;
+	uint32_t *flash_max_write_calls;
+	struct zms_batch_entry batch[4];
+
+	stats_walk(fixture->sim_thresholds, flash_sim_max_write_calls_find, &flash_max_write_calls);
+	stats_walk(fixture->sim_stats, flash_sim_write_calls_find, &flash_write_stat);
+
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	memset(buf, 0xa5, sizeof(buf));
+	fill_batch(batch, ARRAY_SIZE(batch), buf, sizeof(buf));
+	len = zms_write_batch(&fixture->fs, batch, ARRAY_SIZE(batch));
+	zassert_equal(len, ARRAY_SIZE(batch) * sizeof(buf), "zms_write_batch failed: %d", len);
+
+	/* Power down after the BEGIN marker and the data and ATE of the first entry */
+	*flash_write_stat = 0;
+	*flash_max_write_calls = 4;
+
+	memset(buf, 0x5a, sizeof(buf));
+	(void)zms_write_batch(&fixture->fs, batch, ARRAY_SIZE(batch));
+
+	/* Make the flash simulator functional again. */
+	*flash_max_write_calls = 0;
+
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+	check_batch_content(&fixture->fs, ARRAY_SIZE(batch), 0xa5);
+
+	/* The aborted entry is not moved by garbage collection */
+	for (int i = 0; i < fixture->fs.sector_count; i++) {
+		err = zms_sector_use_next(&fixture->fs);
+		zassert_true(err == 0, "zms_sector_use_next call failure: %d", err);
+	}
+
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+	check_batch_content(&fixture->fs, ARRAY_SIZE(batch), 0xa5);
+
+	/* Ensure that the ZMS is able to store new batches. */
+	len = zms_write_batch(&fixture->fs, batch, ARRAY_SIZE(batch));
+	zassert_equal(len, ARRAY_SIZE(batch) * sizeof(buf), "zms_write_batch failed: %d", len);
+	check_batch_content(&fixture->fs, ARRAY_SIZE(batch), 0x5a);
+}
+#endif /* CONFIG_TEST_ZMS_SIMULATOR */
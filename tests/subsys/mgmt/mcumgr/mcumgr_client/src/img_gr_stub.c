@@ -22,6 +22,9 @@
 
 static struct mcumgr_image_data image_dummy_info[2];
 static size_t test_offset;
+static int upload_requests;
+static int drop_request;
+static int stall_request;
 static uint8_t *image_hash_ptr;
 
 #ifdef CONFIG_MCUMGR_GRP_IMG_UPDATABLE_IMAGE_NUMBER
@@ -36,6 +39,24 @@ static uint8_t *image_hash_ptr;
 void img_upload_stub_init(void)
 {
 	test_offset = 0;
+	upload_requests = 0;
+	drop_request = 0;
+	stall_request = 0;
+}
+
+void img_upload_stub_drop(int request)
+{
+	drop_request = request;
+}
+
+void img_upload_stub_stall(int request)
+{
+	stall_request = request;
+}
+
+int img_upload_stub_requests(void)
+{
+	return upload_requests;
 }
 
 void img_upload_response(size_t offset, int status)
@@ -259,8 +280,20 @@ void img_upload_init_verify(struct net_buf *nb)
 		}
 	}
 
+	upload_requests++;
+	if (upload_requests == drop_request ||
+	    (stall_request && upload_requests >= stall_request)) {
+		/* Data lost on the way, report the offset still expected */
+		printf("Drop upload request %d at offset %d\r\n", upload_requests, offset);
+		img_upload_response(test_offset, MGMT_ERR_EOK);
+		return;
+	}
+
 	if (offset != test_offset) {
+		/* Like the server without upload window, data out of order is dropped */
 		printf("Offset not exepected %d vs received %d\r\n", test_offset, offset);
+		img_upload_response(test_offset, MGMT_ERR_EOK);
+		return;
 	}
 
 	if (offset == 0) {
@@ -108,6 +108,57 @@ ZTEST(mcumgr_client, test_img_upload)
 		      response.image_upload_offset);
 }
 
+#if CONFIG_MCUMGR_GRP_IMG_CLIENT_UPLOAD_WINDOW > 1
+ZTEST(mcumgr_client, test_img_upload_window)
+{
+	static uint8_t image[TEST_IMAGE_SIZE];
+	struct mcumgr_image_upload response;
+	int requests;
+	int rc;
+
+	smp_client_send_status_stub(MGMT_ERR_EOK);
+	smp_stub_set_rx_data_verify(img_upload_init_verify);
+
+	/* Upload without loss keeps several requests in flight */
+	img_upload_stub_init();
+	smp_stub_max_in_flight_reset();
+	rc = img_mgmt_client_upload_init(&img_client, TEST_IMAGE_SIZE, TEST_IMAGE_NUM, image_hash);
+	zassert_equal(MGMT_ERR_EOK, rc, "Expected to receive %d response %d", MGMT_ERR_EOK, rc);
+	rc = img_mgmt_client_upload(&img_client, image, TEST_IMAGE_SIZE, &response);
+	zassert_equal(MGMT_ERR_EOK, rc, "Expected to receive %d response %d", MGMT_ERR_EOK, rc);
+	zassert_equal(TEST_IMAGE_SIZE, response.image_upload_offset,
+		      "Expected to receive offset %d response %d", TEST_IMAGE_SIZE,
+		      response.image_upload_offset);
+	zassert_true(smp_stub_max_in_flight() > 1, "Upload requests were not pipelined");
+	zassert_true(smp_stub_max_in_flight() <= CONFIG_MCUMGR_GRP_IMG_CLIENT_UPLOAD_WINDOW,
+		     "Too many upload requests in flight: %d", smp_stub_max_in_flight());
+	requests = img_upload_stub_requests();
+
+	/* Drop the third request, the data after it is resent from the acknowledged offset */
+	img_upload_stub_init();
+	img_upload_stub_drop(3);
+	rc = img_mgmt_client_upload_init(&img_client, TEST_IMAGE_SIZE, TEST_IMAGE_NUM, image_hash);
+	zassert_equal(MGMT_ERR_EOK, rc, "Expected to receive %d response %d", MGMT_ERR_EOK, rc);
+	rc = img_mgmt_client_upload(&img_client, image, TEST_IMAGE_SIZE, &response);
+	zassert_equal(MGMT_ERR_EOK, rc, "Expected to receive %d response %d", MGMT_ERR_EOK, rc);
+	zassert_equal(TEST_IMAGE_SIZE, response.image_upload_offset,
+		      "Expected to receive offset %d response %d", TEST_IMAGE_SIZE,
+		      response.image_upload_offset);
+	zassert_true(img_upload_stub_requests() > requests, "Dropped data was not resent");
+
+	/* Server stops accepting data, the upload reports it instead of success */
+	img_upload_stub_init();
+	img_upload_stub_stall(3);
+	rc = img_mgmt_client_upload_init(&img_client, TEST_IMAGE_SIZE, TEST_IMAGE_NUM, image_hash);
+	zassert_equal(MGMT_ERR_EOK, rc, "Expected to receive %d response %d", MGMT_ERR_EOK, rc);
+	rc = img_mgmt_client_upload(&img_client, image, TEST_IMAGE_SIZE, &response);
+	zassert_equal(MGMT_ERR_EBUSY, rc, "Expected to receive %d response %d", MGMT_ERR_EBUSY,
+		      rc);
+	zassert_true(response.image_upload_offset < TEST_IMAGE_SIZE,
+		     "Unexpected offset %d", response.image_upload_offset);
+}
+#endif
+
 ZTEST(mcumgr_client, test_img_erase)
 {
 	int rc;
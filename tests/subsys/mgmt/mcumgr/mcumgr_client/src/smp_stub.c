@@ -9,16 +9,26 @@
 #include <string.h>
 #include <zephyr/mgmt/mcumgr/smp/smp_client.h>
 #include <zephyr/mgmt/mcumgr/mgmt/mgmt.h>
+#include <zephyr/sys/atomic.h>
 #include <zephyr/sys/byteorder.h>
 #include <mgmt/mcumgr/transport/smp_internal.h>
 #include "smp_stub.h"
 
 K_THREAD_STACK_DEFINE(smp_stub_work_queue_stack, CONFIG_MCUMGR_TRANSPORT_WORKQUEUE_STACK_SIZE);
 
+/* Response queued for a transmitted request */
+struct smp_stub_response {
+	struct smp_hdr hdr;
+	struct net_buf *nb;
+};
+
+K_MSGQ_DEFINE(smp_stub_response_msgq, sizeof(struct smp_stub_response), 16, 4);
+
 static mcmgr_client_data_check_fn rx_verify_cb;
 static int send_client_failure;
 static struct net_buf *response_buf;
-static struct smp_hdr res_hdr;
+static atomic_t in_flight;
+static atomic_t max_in_flight;
 static struct smp_transport smpt_test;
 static struct smp_client_transport_entry smp_client_transport;
 static struct k_work_q smp_work_queue;
@@ -38,6 +48,16 @@ void smp_client_send_status_stub(int status)
 	send_client_failure = status;
 }
 
+int smp_stub_max_in_flight(void)
+{
+	return (int)atomic_get(&max_in_flight);
+}
+
+void smp_stub_max_in_flight_reset(void)
+{
+	atomic_set(&max_in_flight, 0);
+}
+
 struct net_buf *smp_response_buf_allocation(void)
 {
 	smp_client_response_buf_clean();
@@ -70,15 +90,18 @@ static uint16_t smp_uart_get_mtu(const struct net_buf *nb)
 
 static int smp_uart_tx_pkt(struct net_buf *nb)
 {
+	struct smp_stub_response response;
+	atomic_val_t count;
+
 	if (send_client_failure) {
 		/* Test Send cmd fail */
 		return send_client_failure;
 	}
 
-	memcpy(&res_hdr, nb->data, sizeof(res_hdr));
-	res_hdr.nh_len = sys_be16_to_cpu(res_hdr.nh_len);
-	res_hdr.nh_group = sys_be16_to_cpu(res_hdr.nh_group);
-	res_hdr.nh_op += 1; /* Request to response */
+	memcpy(&response.hdr, nb->data, sizeof(response.hdr));
+	response.hdr.nh_len = sys_be16_to_cpu(response.hdr.nh_len);
+	response.hdr.nh_group = sys_be16_to_cpu(response.hdr.nh_group);
+	response.hdr.nh_op += 1; /* Request to response */
 
 	/* Validate Input data if callback is configured */
 	if (rx_verify_cb) {
@@ -88,7 +111,19 @@ static int smp_uart_tx_pkt(struct net_buf *nb)
 	/* Free tx buf */
 	net_buf_unref(nb);
 
+	/* Each request gets its own response, so several requests may be in flight */
 	if (response_buf) {
+		response.nb = net_buf_ref(response_buf);
+		if (k_msgq_put(&smp_stub_response_msgq, &response, K_NO_WAIT) != 0) {
+			net_buf_unref(response.nb);
+			return 0;
+		}
+
+		count = atomic_inc(&in_flight) + 1;
+		if (count > atomic_get(&max_in_flight)) {
+			atomic_set(&max_in_flight, count);
+		}
+
 		k_work_submit_to_queue(&smp_work_queue, &stub_work);
 	}
 
@@ -97,8 +132,12 @@ static int smp_uart_tx_pkt(struct net_buf *nb)
 
 static void smp_client_handle_reqs(struct k_work *work)
 {
-	if (response_buf) {
-		smp_client_single_response(response_buf, &res_hdr);
+	struct smp_stub_response response;
+
+	while (k_msgq_get(&smp_stub_response_msgq, &response, K_NO_WAIT) == 0) {
+		atomic_dec(&in_flight);
+		smp_client_single_response(response.nb, &response.hdr);
+		net_buf_unref(response.nb);
 	}
 }
 
@@ -19,6 +19,8 @@ typedef void (*mcmgr_client_data_check_fn)(struct net_buf *nb);
 
 void smp_stub_set_rx_data_verify(mcmgr_client_data_check_fn cb);
 void smp_client_send_status_stub(int status);
+int smp_stub_max_in_flight(void);
+void smp_stub_max_in_flight_reset(void);
 void smp_client_response_buf_clean(void);
 struct net_buf *smp_response_buf_allocation(void);
 void stub_smp_client_transport_register(void);
@@ -22,4 +22,66 @@ ZTEST(settings_functional, test_setting_storage_get)
 	rc = zms_write((struct zms_fs *)storage, 512, &data, sizeof(data));
 	zassert_true(rc >= 0, "Can't write ZMS entry (err=%d).", rc);
 }
+
+#define LARGE_VAL_BUF_SIZE 4096
+
+static uint8_t large_val[LARGE_VAL_BUF_SIZE];
+static uint8_t large_val_read[LARGE_VAL_BUF_SIZE];
+
+static int large_val_loader(const char *key, size_t len, settings_read_cb read_cb,
+			    void *cb_arg, void *param)
+{
+	size_t *read_len = param;
+	ssize_t rc;
+
+	if (len > sizeof(large_val_read)) {
+		return -EINVAL;
+	}
+
+	rc = read_cb(cb_arg, large_val_read, len);
+	if (rc < 0) {
+		return rc;
+	}
+
+	*read_len = rc;
+	return 0;
+}
+
+ZTEST(settings_functional, test_setting_save_large_value)
+{
+	struct zms_fs *fs;
+	void *storage;
+	size_t read_len = 0;
+	size_t len;
+	int rc;
+
+	rc = settings_subsys_init();
+	zassert_equal(0, rc, "Can't init settings (err=%d)", rc);
+
+	rc = settings_storage_get(&storage);
+	zassert_equal(0, rc, "Can't fetch storage reference (err=%d)", rc);
+	fs = storage;
+
+	/* Largest value ZMS accepts, too large to be written with its name in one batch */
+	len = fs->sector_size - 5 * fs->ate_size;
+	if (len > sizeof(large_val)) {
+		ztest_test_skip();
+	}
+
+	for (size_t i = 0; i < len; i++) {
+		large_val[i] = (uint8_t)(i * 7);
+	}
+
+	rc = settings_save_one("large/val", large_val, len);
+	zassert_equal(0, rc, "Can't save large value (err=%d)", rc);
+
+	rc = settings_load_subtree_direct("large/val", large_val_loader, &read_len);
+	zassert_equal(0, rc, "Can't load large value (err=%d)", rc);
+	zassert_equal(len, read_len, "Unexpected value length %zu", read_len);
+	zassert_mem_equal(large_val, large_val_read, len, "Loaded value differs");
+
+	rc = settings_delete("large/val");
+	zassert_equal(0, rc, "Can't delete large value (err=%d)", rc);
+}
+
 ZTEST_SUITE(settings_functional, NULL, NULL, NULL, NULL, NULL);
@@ -37,6 +37,41 @@ struct test_setting test_settings[TEST_SETTINGS_COUNT];
 
 K_SEM_DEFINE(waitfor_work, 0, 1);
 
+static uint32_t loaded_count;
+
+static int perf_set(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg)
+{
+	struct test_setting setting;
+	unsigned long i = strtoul(key, NULL, 16);
+	ssize_t rc;
+
+	zassert_true(i < TEST_SETTINGS_COUNT, "unexpected key %s", key);
+	zassert_equal(len, sizeof(setting), "unexpected length %zu", len);
+
+	rc = read_cb(cb_arg, &setting, sizeof(setting));
+	zassert_equal(rc, sizeof(setting), "read failed %d", (int)rc);
+	zassert_equal(setting.val, test_settings[i].val, "unexpected value of %s", key);
+
+	loaded_count++;
+	return 0;
+}
+
+static int perf_set_parent(const char *key, size_t len, settings_read_cb read_cb,
+			   void *cb_arg)
+{
+	zassert_unreachable("%s loaded by a less specific handler", key);
+
+	return 0;
+}
+
+/* The most specific handler, whatever their order, must get the settings */
+SETTINGS_STATIC_HANDLER_DEFINE(perf_ab, "ab", NULL, perf_set_parent, NULL, NULL);
+SETTINGS_STATIC_HANDLER_DEFINE(perf_ab_cdef_ghi, "ab/cdef/ghi", NULL, perf_set, NULL, NULL);
+SETTINGS_STATIC_HANDLER_DEFINE(perf_ab_cdef, "ab/cdef", NULL, perf_set_parent, NULL, NULL);
+SETTINGS_STATIC_HANDLER_DEFINE(perf_ab_cdef_gh, "ab/cdef/gh", NULL, perf_set_parent, NULL,
+			       NULL);
+SETTINGS_STATIC_HANDLER_DEFINE(perf_cd, "cd", NULL, perf_set_parent, NULL, NULL);
+
 static void store_pending(struct k_work *work)
 {
 	int err;
@@ -132,3 +167,33 @@ ZTEST(settings_perf, test_performance)
 		zassert_equal(err, 0, "Scanning failed to stop (err %d)\n", err);
 	}
 }
+
+ZTEST(settings_perf, test_performance_load)
+{
+	char path[20];
+	uint32_t start;
+	uint32_t cycles;
+	int err;
+
+	err = settings_subsys_init();
+	zassert_equal(err, 0, "settings_backend_init failed %d", err);
+
+	/* Store the entries to load, independently of the other tests */
+	for (int i = 0; i < TEST_SETTINGS_COUNT; i++) {
+		test_settings[i].val = TEST_SETTINGS_COUNT * TEST_STORE_ITR + i;
+
+		snprintk(path, sizeof(path), "ab/cdef/ghi/%04x", i);
+		err = settings_save_one(path, &test_settings[i], sizeof(struct test_setting));
+		zassert_equal(err, 0, "settings_save_one failed %d", err);
+	}
+
+	loaded_count = 0;
+	start = k_cycle_get_32();
+	err = settings_load_subtree("ab");
+	cycles = k_cycle_get_32() - start;
+	zassert_equal(err, 0, "settings_load_subtree failed %d", err);
+	zassert_equal(loaded_count, TEST_SETTINGS_COUNT, "loaded %u entries", loaded_count);
+
+	printk("*** loading of %u entries completed ***\n", loaded_count);
+	printk("load time: %u us\n", k_cyc_to_us_floor32(cycles));
+}
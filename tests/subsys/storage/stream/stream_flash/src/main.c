@@ -430,21 +430,24 @@ ZTEST(lib_stream_flash, test_stream_flash_flush)
 	zassert_equal(rc, 0, "expected success");
 }
 
-#ifdef CONFIG_STREAM_FLASH_ERASE
+#if defined(CONFIG_STREAM_FLASH_ERASE)
 ZTEST(lib_stream_flash, test_stream_flash_buffered_write_whole_page)
 {
+	/* Pages erased when writing a page in BUF_LEN chunks, including erase-ahead */
+	size_t erased = ROUND_UP(CONFIG_STREAM_FLASH_ERASE_AHEAD_SIZE + BUF_LEN, page_size);
 	int rc;
 
+	zassume_true(erased + page_size <= TESTBUF_SIZE, "erase ahead size too large for test");
+
 	init_target();
 
 	/* Write all bytes of a page, verify that next page is not erased */
 
-	/* First fill two pages with data */
-	rc = stream_flash_buffered_write(&ctx, write_buf, page_size * 2, true);
+	/* First fill the pages with data, up to one page past the erased range */
+	rc = stream_flash_buffered_write(&ctx, write_buf, erased + page_size, true);
 	zassert_equal(rc, 0, "expected success");
 
-	VERIFY_WRITTEN(0, page_size);
-	VERIFY_WRITTEN(page_size, page_size);
+	VERIFY_WRITTEN(0, erased + page_size);
 
 	/* Reset stream_flash context */
 	memset(&ctx, 0, sizeof(ctx));
@@ -457,8 +460,45 @@ ZTEST(lib_stream_flash, test_stream_flash_buffered_write_whole_page)
 	rc = stream_flash_buffered_write(&ctx, write_buf, page_size, true);
 	zassert_equal(rc, 0, "expected success");
 
-	/* Second page should not be erased */
-	VERIFY_WRITTEN(page_size, page_size);
+	/* Only the erase-ahead pages should be erased, the next page should not */
+	VERIFY_WRITTEN(0, page_size);
+	if (erased > page_size) {
+		VERIFY_ERASED(page_size, erased - page_size);
+	}
+	VERIFY_WRITTEN(erased, page_size);
+}
+#endif
+
+#if defined(CONFIG_STREAM_FLASH_ERASE) && (CONFIG_STREAM_FLASH_ERASE_AHEAD_SIZE > 0)
+ZTEST(lib_stream_flash, test_stream_flash_erase_ahead)
+{
+	size_t ahead = ROUND_UP(CONFIG_STREAM_FLASH_ERASE_AHEAD_SIZE + BUF_LEN, page_size);
+	int rc;
+
+	zassume_true(ahead <= TESTBUF_SIZE, "erase ahead size too large for test");
+
+	init_target();
+
+	/* Dirty the last page that is expected to be erased ahead */
+	rc = flash_write(fdev, FLASH_BASE + ahead - page_size, write_buf, BUF_LEN);
+	zassert_equal(rc, 0, "should succeed");
+
+	rc = stream_flash_buffered_write(&ctx, write_buf, BUF_LEN, true);
+	zassert_equal(rc, 0, "expected success");
+
+	VERIFY_WRITTEN(0, BUF_LEN);
+	zassert_equal(ctx.erased_up_to, ahead, "unexpected erase offset %zu", ctx.erased_up_to);
+	VERIFY_ERASED(ahead - page_size, page_size);
+
+	/* Writes within the erased range do not erase again */
+	rc = flash_write(fdev, FLASH_BASE + ahead - BUF_LEN, write_buf, BUF_LEN);
+	zassert_equal(rc, 0, "should succeed");
+
+	rc = stream_flash_buffered_write(&ctx, write_buf, ahead - 2 * BUF_LEN, true);
+	zassert_equal(rc, 0, "expected success");
+
+	zassert_equal(ctx.erased_up_to, ahead, "unexpected erase offset %zu", ctx.erased_up_to);
+	VERIFY_WRITTEN(ahead - BUF_LEN, BUF_LEN);
 }
 #endif
 
@@ -585,9 +625,14 @@ ZTEST(lib_stream_flash, test_stream_flash_progress_resume)
 	bytes_written = load_progress(progress_key);
 	zassert_equal(bytes_written, bytes_written_old,
 		      "expected bytes_written to be loaded");
-#if defined(CONFIG_STREAM_FLASH_ERASE)
-	zassert_equal(erased_up_to_old, ctx.erased_up_to,
+#ifdef CONFIG_STREAM_FLASH_ERASE
+	/* Erase-ahead is not part of the saved progress, only the pages
+	 * holding written data are known to be erased after loading it.
+	 */
+	zassert_equal(ROUND_UP(bytes_written_old, page_size), ctx.erased_up_to,
 		      "expected last erased page offset to be loaded");
+	zassert_true(erased_up_to_old >= ctx.erased_up_to,
+		     "expected loaded erase offset within erased range");
 #endif
 
 	/* Check that outdated progress does not overwrite current progress */
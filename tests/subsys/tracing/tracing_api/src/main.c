@@ -26,6 +26,7 @@
 static bool data_format_found;
 static bool raw_data_format_found;
 static bool sync_string_format_found;
+static uint32_t backend_output_len;
 #ifdef CONFIG_TRACING_ASYNC
 static bool async_tracing_api;
 static bool tracing_api_found;
@@ -64,6 +65,8 @@ static void tracing_backends_output(
 		const struct tracing_backend *backend,
 		uint8_t *data, uint32_t length)
 {
+	backend_output_len += length;
+
 	/* Check the output data. */
 #ifdef CONFIG_TRACING_ASYNC
 	if (async_tracing_api) {
@@ -195,6 +198,58 @@ ZTEST(tracing_api, test_tracing_sys_api)
 	zassert_true(tracing_api_not_found == false, "Failed to check output from backend");
 	async_tracing_api = false;
 }
+
+#if CONFIG_TRACING_BUFFER_FLUSH_WATERMARK > 0
+static void tracing_watermark_put(uint32_t length)
+{
+	static uint8_t data[CONFIG_TRACING_BUFFER_SIZE];
+	bool before_put_is_empty = tracing_buffer_is_empty();
+
+	zassert_equal(tracing_buffer_put(data, length), length, "Failed to fill the buffer");
+	tracing_trigger_output(before_put_is_empty);
+}
+
+/**
+ * @brief Test tracing buffer flush watermark
+ *
+ * @details Fill the tracing buffer up to the watermark and check that the
+ * tracing thread keeps waiting for the threshold, then go one byte above it
+ * and check that the buffer is flushed to the backend right away. This is
+ * done twice to check that the early wake up is armed again once the buffer
+ * was drained.
+ *
+ * @ingroup tracing_api_tests
+ */
+ZTEST(tracing_api, test_tracing_flush_watermark)
+{
+	uint8_t cmd_disable[] = "disable";
+	uint8_t cmd_enable[] = "enable";
+	uint32_t watermark;
+
+	/* Keep kernel events out of the buffer and let it drain */
+	tracing_cmd_handle(cmd_disable, sizeof(cmd_disable));
+	k_sleep(K_MSEC(2 * CONFIG_TRACING_THREAD_WAIT_THRESHOLD));
+	zassert_true(tracing_buffer_is_empty(), "Tracing buffer was not drained");
+
+	watermark = tracing_buffer_capacity_get() * CONFIG_TRACING_BUFFER_FLUSH_WATERMARK / 100U;
+
+	for (int i = 0; i < 2; i++) {
+		backend_output_len = 0;
+
+		tracing_watermark_put(watermark);
+		k_sleep(K_MSEC(CONFIG_TRACING_THREAD_WAIT_THRESHOLD / 2));
+		zassert_equal(backend_output_len, 0, "Flushed at the watermark");
+
+		tracing_watermark_put(1);
+		k_sleep(K_MSEC(CONFIG_TRACING_THREAD_WAIT_THRESHOLD / 4));
+		zassert_equal(backend_output_len, watermark + 1,
+			      "Not flushed above the watermark (%u bytes)", backend_output_len);
+		zassert_true(tracing_buffer_is_empty(), "Tracing buffer was not drained");
+	}
+
+	tracing_cmd_handle(cmd_enable, sizeof(cmd_enable));
+}
+#endif /* CONFIG_TRACING_BUFFER_FLUSH_WATERMARK > 0 */
 #else
 /**
  * @brief Test tracing APIS